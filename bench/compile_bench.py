@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""Compile-time cost of the metaprogramming headers.
+
+Every suite generates a translation unit whose workload grows with N:
+
+    type_lists    a type list of N ValueTags, mapped, filtered, folded and
+                  compared against Take<N, Nats> (task1)
+    fixed_string  N distinct FixedString literals used as template
+                  arguments (task2)
+    enum_traits   an enum with N enumerators, looked up by value and name
+                  through EnumeratorTraits (task4)
+    describe      an aggregate with N fields, reflected with Describe<T>
+                  and serialized, compared and hashed (task5)
+
+Each TU is compiled to an object file (-c, -O0 by default), and the table
+records the best wall time over --repeat runs, the peak resident memory of
+the compiler, the object size and the number of defined symbols. The last
+column is the growth of the time relative to the previous row of the same
+suite. Rows are sorted and fixed-width, so tables of two versions diff
+line by line:
+
+    python3 bench/compile_bench.py --output before.txt
+    python3 bench/compile_bench.py --output after.txt
+    diff before.txt after.txt
+
+The CMake target compile_bench runs the default configuration.
+"""
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INCLUDE_DIRS = ["task0", "task1", "task2", "task4", "task5"]
+
+
+def type_lists(n):
+    values = ", ".join(str(i) for i in range(n))
+    shifted = ", ".join(str(i + 1) for i in range(n))
+    return f"""
+#include <type_traits>
+#include <fun_value_sequences.hpp>
+#include <type_lists.hpp>
+
+using L = FromTuple<VTuple<int, {values}>>;
+
+template <class T>
+struct IsEven {{
+    static constexpr bool Value = T::Value % 2 == 0;
+}};
+
+static_assert(std::is_same_v<ToTuple<Map<Inc, L>>, VTuple<int, {shifted}>>);
+static_assert(std::is_same_v<ToTuple<Take<{n}, Nats>>, ToTuple<L>>);
+static_assert(Foldl<Plus, ValueTag<0>, L>::Value == {n * (n - 1) // 2});
+static_assert(std::is_same_v<ToTuple<Filter<IsEven, L>>, ToTuple<Filter<IsEven, Take<{n}, Nats>>>>);
+
+int Sum() {{ return Foldl<Plus, ValueTag<0>, Map<Inc, L>>::Value; }}
+"""
+
+
+def fixed_string(n):
+    lines = [
+        "#include <string_view>",
+        "#include <FixedString.hpp>",
+        "",
+        "template <FixedString<256> S>",
+        "struct Key {",
+        "    static constexpr std::string_view value = S;",
+        "};",
+        "",
+        "std::size_t Total() {",
+        "    std::size_t total = 0;",
+    ]
+    for i in range(n):
+        lines.append(f'    total += Key<"key_{i}_{"x" * (i % 16)}"_cstr>::value.size();')
+    lines += ["    return total;", "}"]
+    return "\n".join(lines) + "\n"
+
+
+def enum_traits(n):
+    enumerators = ", ".join(f"V{i} = {i * 3 - n}" for i in range(n))
+    maxn = max(64, 4 * n)
+    return f"""
+#include <string_view>
+#include <EnumeratorTraits.hpp>
+
+enum class E : int {{ {enumerators} }};
+
+using Traits = EnumeratorTraits<E, {maxn}>;
+static_assert(Traits::size() == {n});
+static_assert(Traits::nameOf(E::V{n - 1}) == "V{n - 1}");
+static_assert(Traits::fromName("V0") == E::V0);
+
+std::string_view Name(E value) {{ return Traits::nameOf(value); }}
+std::size_t Index(std::string_view name) {{ return Traits::indexOfName(name); }}
+"""
+
+
+def describe(n):
+    types = ["int", "double", "std::string", "std::uint16_t"]
+    fields = "\n".join(f"    {types[i % len(types)]} f{i};" for i in range(n))
+    return f"""
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <Compare.hpp>
+#include <Serialize.hpp>
+#include <reflect.hpp>
+
+struct S {{
+{fields}
+}};
+
+static_assert(Describe<S>::num_fields == {n});
+
+std::vector<std::byte> Write(const S &s) {{ return serialize::Serialize(s); }}
+S Read(std::span<const std::byte> bytes) {{ return serialize::Deserialize<S>(bytes); }}
+bool Same(const S &a, const S &b) {{ return compare::Equal(a, b); }}
+std::size_t Hash(const S &s) {{ return compare::Hash(s); }}
+"""
+
+
+SUITES = {
+    "type_lists": (type_lists, [25, 50, 100, 200]),
+    "fixed_string": (fixed_string, [50, 100, 200, 400]),
+    "enum_traits": (enum_traits, [16, 32, 64, 128]),
+    "describe": (describe, [8, 16, 32, 64]),
+}
+
+
+def compile_once(command):
+    """Runs the compiler and returns (seconds, peak RSS in KiB)."""
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stderr=subprocess.PIPE)
+    _, status, usage = os.wait4(process.pid, 0)
+    elapsed = time.perf_counter() - start
+    stderr = process.stderr.read().decode(errors="replace")
+    process.stderr.close()
+    if os.waitstatus_to_exitcode(status) != 0:
+        sys.exit(f"compilation failed: {' '.join(command)}\n{stderr}")
+    return elapsed, usage.ru_maxrss
+
+
+def count_symbols(nm, path):
+    if nm is None:
+        return None
+    output = subprocess.run([nm, "--defined-only", path], check=True,
+                            capture_output=True, text=True).stdout
+    return sum(1 for line in output.splitlines() if line.strip())
+
+
+def measure(args, source):
+    with tempfile.TemporaryDirectory() as directory:
+        path = os.path.join(directory, "bench.cpp")
+        obj = os.path.join(directory, "bench.o")
+        with open(path, "w") as f:
+            f.write(source)
+        command = [args.cxx, "-std=c++20", args.opt, "-c", "-fconstexpr-ops-limit=1000000000",
+                   "-ftemplate-depth=4096"]
+        command += [f"-I{os.path.join(ROOT, d)}" for d in INCLUDE_DIRS]
+        command += [path, "-o", obj]
+        best_seconds, peak = None, 0
+        for _ in range(args.repeat):
+            seconds, rss = compile_once(command)
+            best_seconds = seconds if best_seconds is None else min(best_seconds, seconds)
+            peak = max(peak, rss)
+        return best_seconds, peak, os.path.getsize(obj), count_symbols(args.nm, obj)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "g++"))
+    parser.add_argument("--nm", default=shutil.which("nm"))
+    parser.add_argument("--opt", default="-O0", help="optimization flag passed to the compiler")
+    parser.add_argument("--suite", nargs="+", default=list(SUITES), choices=list(SUITES))
+    parser.add_argument("--sizes", type=int, nargs="+",
+                        help="workload sizes, overriding each suite's defaults")
+    parser.add_argument("--repeat", type=int, default=3)
+    parser.add_argument("--output", help="also write the table to this file")
+    args = parser.parse_args()
+
+    header = (f"{'suite':<13} {'n':>5} {'seconds':>8} {'peak MiB':>9} "
+              f"{'object KiB':>11} {'symbols':>8} {'growth':>7}")
+    rows = [header]
+    print(header)
+    for suite in args.suite:
+        generate, default_sizes = SUITES[suite]
+        previous = None
+        for n in args.sizes or default_sizes:
+            seconds, peak, size, symbols = measure(args, generate(n))
+            growth = f"{seconds / previous:.2f}x" if previous else "-"
+            previous = seconds
+            row = (f"{suite:<13} {n:>5} {seconds:>8.2f} {peak / 1024:>9.1f} "
+                   f"{size / 1024:>11.1f} {symbols if symbols is not None else '-':>8} {growth:>7}")
+            rows.append(row)
+            print(row)
+            sys.stdout.flush()
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write("\n".join(rows) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""Compile-time benchmark for task4/EnumeratorTraits.hpp.
+
+Generates a translation unit with NUM_ENUMS enums, forces EnumeratorTraits
+to be computed for each of them and measures how long the compiler takes
+(-fsyntax-only, so only template instantiation and constant evaluation are
+measured). The "naive" implementation probes one value per instantiation
+and is kept here only as a baseline.
+
+    python3 bench/enum_traits_bench.py --enums 50 100 200 --maxn 128 512 1024
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+NAIVE = r"""
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+template <auto V>
+constexpr std::string_view NaiveSignature() { return __PRETTY_FUNCTION__; }
+
+template <auto V>
+constexpr bool NaiveIsEnumerator() {
+    constexpr std::string_view s = NaiveSignature<V>();
+    constexpr std::size_t pos = s.find("V = ") + 4;
+    return s[pos] != '(' && (s[pos] < '0' || s[pos] > '9') && s[pos] != '-';
+}
+
+template <class Enum, std::size_t MAXN>
+struct EnumeratorTraits {
+    static constexpr std::size_t size() noexcept {
+        return []<std::size_t... Is>(std::index_sequence<Is...>) {
+            return (std::size_t{0} + ... +
+                    NaiveIsEnumerator<static_cast<Enum>(static_cast<std::intmax_t>(Is) -
+                                                        static_cast<std::intmax_t>(MAXN))>());
+        }(std::make_index_sequence<2 * MAXN + 1>{});
+    }
+};
+"""
+
+
+def generate(num_enums, maxn, enumerators, impl):
+    lines = []
+    if impl == "batched":
+        lines.append("#include <EnumeratorTraits.hpp>")
+    else:
+        lines.append(NAIVE)
+    for e in range(num_enums):
+        values = ", ".join(
+            f"V{k} = {(k * 7 + e) % maxn - maxn // 2}" for k in range(enumerators)
+        )
+        lines.append(f"enum class E{e} : int {{ {values} }};")
+        lines.append(
+            f"static_assert(EnumeratorTraits<E{e}, {maxn}>::size() <= {enumerators});"
+        )
+    return "\n".join(lines) + "\n"
+
+
+def compile_seconds(cxx, source, repeat):
+    with tempfile.NamedTemporaryFile("w", suffix=".cpp", delete=False) as f:
+        f.write(source)
+        path = f.name
+    try:
+        best = None
+        for _ in range(repeat):
+            start = time.perf_counter()
+            subprocess.run(
+                [cxx, "-std=c++20", "-fsyntax-only", "-fconstexpr-ops-limit=1000000000",
+                 "-I", os.path.join(ROOT, "task4"), path],
+                check=True,
+            )
+            elapsed = time.perf_counter() - start
+            best = elapsed if best is None else min(best, elapsed)
+        return best
+    finally:
+        os.unlink(path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "g++"))
+    parser.add_argument("--enums", type=int, nargs="+", default=[10, 50, 100])
+    parser.add_argument("--maxn", type=int, nargs="+", default=[128, 512])
+    parser.add_argument("--enumerators", type=int, default=16)
+    parser.add_argument("--impl", nargs="+", default=["batched", "naive"],
+                        choices=["batched", "naive"])
+    parser.add_argument("--repeat", type=int, default=1)
+    args = parser.parse_args()
+
+    print(f"{'impl':>8} {'enums':>6} {'maxn':>6} {'seconds':>9} {'ms/enum':>8}")
+    for impl in args.impl:
+        for maxn in args.maxn:
+            for num_enums in args.enums:
+                source = generate(num_enums, maxn, args.enumerators, impl)
+                seconds = compile_seconds(args.cxx, source, args.repeat)
+                print(f"{impl:>8} {num_enums:>6} {maxn:>6} {seconds:>9.2f} "
+                      f"{1000 * seconds / num_enums:>8.1f}")
+                sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
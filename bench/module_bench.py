@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Build time of bench/module_consumer.cpp against headers and modules.
+
+Builds the module interfaces in modules/ once, then compiles the consumer
+TU against the headers and against `import metaprogramming;`. Each consumer
+compile stands for one TU of a larger codebase, so the table extrapolates
+to --tus translation units: the header build pays the per-TU cost every
+time, the module build pays the interfaces once plus its per-TU cost.
+
+    python3 bench/module_bench.py --tus 1 10 100 1000
+
+Needs g++ 11 or newer (-fmodules-ts).
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INCLUDE_DIRS = ["task0", "task1", "task2"]
+CONSUMER = os.path.join(ROOT, "bench", "module_consumer.cpp")
+
+# Interface units in dependency order.
+MODULES = [
+    ("metaprogramming.slice", "slice.cppm"),
+    ("metaprogramming.type_lists", "type_lists.cppm"),
+    ("metaprogramming.fixed_string", "fixed_string.cppm"),
+    ("metaprogramming", "metaprogramming.cppm"),
+]
+
+
+def compile_once(command):
+    """Runs the compiler and returns (seconds, peak RSS in KiB)."""
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stderr=subprocess.PIPE)
+    _, status, usage = os.wait4(process.pid, 0)
+    elapsed = time.perf_counter() - start
+    stderr = process.stderr.read().decode(errors="replace")
+    process.stderr.close()
+    if os.waitstatus_to_exitcode(status) != 0:
+        sys.exit(f"compilation failed: {' '.join(command)}\n{stderr}")
+    return elapsed, usage.ru_maxrss
+
+
+def best_of(repeat, command):
+    runs = [compile_once(command) for _ in range(repeat)]
+    return min(seconds for seconds, _ in runs), max(rss for _, rss in runs)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "g++"))
+    parser.add_argument("--opt", default="-O0", help="optimization flag passed to the compiler")
+    parser.add_argument("--tus", type=int, nargs="+", default=[1, 10, 100, 1000])
+    parser.add_argument("--repeat", type=int, default=3)
+    parser.add_argument("--output", help="also write the table to this file")
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as directory:
+        mapper = os.path.join(directory, "module.map")
+        with open(mapper, "w") as f:
+            for name, _ in MODULES:
+                f.write(f"{name} {os.path.join(directory, name + '.gcm')}\n")
+
+        base = [args.cxx, "-std=c++20", args.opt, "-c"]
+        base += [f"-I{os.path.join(ROOT, d)}" for d in INCLUDE_DIRS]
+        modules = ["-fmodules-ts", f"-fmodule-mapper={mapper}"]
+
+        interface_seconds, interface_rss = 0.0, 0
+        for name, source in MODULES:
+            seconds, rss = best_of(args.repeat, base + modules + [
+                "-x", "c++", os.path.join(ROOT, "modules", source),
+                "-o", os.path.join(directory, name + ".o")])
+            interface_seconds += seconds
+            interface_rss = max(interface_rss, rss)
+
+        obj = os.path.join(directory, "consumer.o")
+        header_seconds, header_rss = best_of(args.repeat, base + [CONSUMER, "-o", obj])
+        module_seconds, module_rss = best_of(
+            args.repeat, base + modules + ["-DMETAPROGRAMMING_USE_MODULES", CONSUMER, "-o", obj])
+
+    rows = [
+        f"interfaces   {interface_seconds:8.2f} s  peak {interface_rss / 1024:7.1f} MiB",
+        f"header TU    {header_seconds:8.2f} s  peak {header_rss / 1024:7.1f} MiB",
+        f"module TU    {module_seconds:8.2f} s  peak {module_rss / 1024:7.1f} MiB",
+    ]
+    if module_seconds < header_seconds:
+        rows.append(f"break-even   {interface_seconds / (header_seconds - module_seconds):8.1f} TUs")
+    else:
+        rows.append("break-even          - (module TU is not faster)")
+    rows.append("")
+    rows.append(f"{'TUs':>6} {'headers s':>10} {'modules s':>10} {'saved':>7}")
+    for tus in args.tus:
+        headers = tus * header_seconds
+        modules_total = interface_seconds + tus * module_seconds
+        rows.append(f"{tus:>6} {headers:>10.2f} {modules_total:>10.2f} "
+                    f"{100 * (1 - modules_total / headers):>6.1f}%")
+
+    print("\n".join(rows))
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write("\n".join(rows) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,75 @@
+// A typical user of task0 to task2, built twice: against the headers and,
+// with METAPROGRAMMING_USE_MODULES defined, against `import metaprogramming;`.
+// bench/module_bench.py compiles it both ways to compare build times.
+
+#include <cstdio>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#ifdef METAPROGRAMMING_USE_MODULES
+import metaprogramming;
+#else
+#include <FixedString.hpp>
+#include <PolymorphicMapper.hpp>
+#include <Slice.hpp>
+#include <fun_value_sequences.hpp>
+#include <type_lists.hpp>
+#endif
+
+using namespace type_lists;
+using namespace value_types;
+
+template <class T>
+struct IsEven {
+    static constexpr bool Value = T::Value % 2 == 0;
+};
+
+static_assert(std::is_same_v<ToTuple<Take<8, Primes>>, VTuple<int, 2, 3, 5, 7, 11, 13, 17, 19>>);
+static_assert(std::is_same_v<ToTuple<Take<8, Fib>>, VTuple<int, 0, 1, 1, 2, 3, 5, 8, 13>>);
+static_assert(std::is_same_v<ToTuple<Filter<IsEven, Take<10, Nats>>>, VTuple<int, 0, 2, 4, 6, 8>>);
+static_assert(Foldl<Plus, ValueTag<0>, Take<100, Nats>>::Value == 4950);
+
+template <FixedString<256> Name>
+struct Column {
+    static constexpr std::string_view name = Name;
+};
+
+struct Shape {
+    virtual ~Shape() = default;
+};
+
+struct Circle : Shape {};
+struct Square : Shape {};
+
+enum class Kind { Circle, Square };
+
+using KindOf = PolymorphicMapper<Shape, Kind, Mapping<Circle, Kind::Circle>, Mapping<Square, Kind::Square>>;
+
+template <class T>
+T SumEverySecond(std::vector<T> &values) {
+    T sum{};
+    for (const T value : Slice(values).Skip(2)) {
+        sum += value;
+    }
+    return sum;
+}
+
+int main() {
+    std::vector<int> ints{1, 2, 3, 4, 5, 6};
+    std::vector<long> longs{1, 2, 3, 4};
+    std::vector<double> doubles{0.5, 1.5, 2.5};
+    std::vector<float> floats{1.0f, 2.0f};
+
+    Slice<int> slice(ints);
+    int tail = 0;
+    for (const int value : slice.DropFirst(2)) {
+        tail += value;
+    }
+
+    const Square square;
+    const std::size_t names = Column<"price"_cstr>::name.size() + Column<"quantity"_cstr>::name.size();
+    std::printf("%d %ld %.1f %.1f %d %zu %d\n", SumEverySecond(ints), SumEverySecond(longs), SumEverySecond(doubles),
+                SumEverySecond(floats), tail, names, static_cast<int>(*KindOf::map(square)));
+}
@@ -0,0 +1,127 @@
+// Throughput of task5/Serialize.hpp against a hand-written serializer for
+// the same message.
+//
+//     g++ -std=c++20 -O2 -I task5 bench/serialize_bench.cpp -o serialize_bench
+//     ./serialize_bench [messages]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <Serialize.hpp>
+
+struct Tick {
+    std::uint64_t id;
+    std::uint64_t timestamp;
+    double price;
+    double size;
+    std::int32_t venue;
+    std::uint16_t flags;
+    char side;
+    std::string symbol;
+};
+
+namespace handwritten {
+
+void Write(const Tick &tick, std::vector<std::byte> &out) {
+    const std::size_t offset = out.size();
+    out.resize(offset + 8 + 8 + 8 + 8 + 4 + 2 + 1 + 1 + tick.symbol.size());
+    std::byte *pos = out.data() + offset;
+    auto put = [&](const void *data, std::size_t size) {
+        std::memcpy(pos, data, size);
+        pos += size;
+    };
+    put(&tick.id, 8);
+    put(&tick.timestamp, 8);
+    put(&tick.price, 8);
+    put(&tick.size, 8);
+    put(&tick.venue, 4);
+    put(&tick.flags, 2);
+    put(&tick.side, 1);
+    const auto length = static_cast<std::uint8_t>(tick.symbol.size());
+    put(&length, 1);
+    put(tick.symbol.data(), tick.symbol.size());
+}
+
+std::size_t Read(const std::byte *pos, Tick &tick) {
+    const std::byte *begin = pos;
+    auto get = [&](void *data, std::size_t size) {
+        std::memcpy(data, pos, size);
+        pos += size;
+    };
+    get(&tick.id, 8);
+    get(&tick.timestamp, 8);
+    get(&tick.price, 8);
+    get(&tick.size, 8);
+    get(&tick.venue, 4);
+    get(&tick.flags, 2);
+    get(&tick.side, 1);
+    std::uint8_t length = 0;
+    get(&length, 1);
+    tick.symbol.assign(reinterpret_cast<const char *>(pos), length);
+    pos += length;
+    return static_cast<std::size_t>(pos - begin);
+}
+
+} // namespace handwritten
+
+template <class F>
+double Seconds(F &&f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv) {
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2'000'000;
+
+    std::vector<Tick> ticks(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        ticks[i] = {i, 1'700'000'000'000 + i, 100.0 + i % 17, 1.0 + i % 5, static_cast<std::int32_t>(i % 7),
+                    static_cast<std::uint16_t>(i), i % 2 ? 'B' : 'S', i % 3 ? "AAPL" : "MSFT"};
+    }
+
+    std::vector<std::byte> generated;
+    std::vector<std::byte> manual;
+    generated.reserve(count * 64);
+    manual.reserve(count * 64);
+    Tick tick;
+    std::uint64_t checksum = 0;
+
+    const double write_generated = Seconds([&] {
+        for (const Tick &t : ticks) {
+            serialize::Serialize(t, generated);
+        }
+    });
+    const double write_manual = Seconds([&] {
+        for (const Tick &t : ticks) {
+            handwritten::Write(t, manual);
+        }
+    });
+    const double read_generated = Seconds([&] {
+        std::span<const std::byte> in = generated;
+        while (!in.empty()) {
+            in = in.subspan(serialize::Deserialize(in, tick));
+            checksum += tick.id;
+        }
+    });
+    const double read_manual = Seconds([&] {
+        for (std::size_t pos = 0; pos < manual.size();) {
+            pos += handwritten::Read(manual.data() + pos, tick);
+            checksum += tick.id;
+        }
+    });
+
+    auto report = [](const char *name, double seconds, std::size_t bytes) {
+        std::printf("%-16s %8.3f s %8.1f MB/s\n", name, seconds, bytes / seconds / 1e6);
+    };
+    report("write generated", write_generated, generated.size());
+    report("write manual", write_manual, manual.size());
+    report("read generated", read_generated, generated.size());
+    report("read manual", read_manual, manual.size());
+    std::printf("checksum %llu\n", static_cast<unsigned long long>(checksum));
+}
@@ -0,0 +1,17 @@
+// task2: FixedString and PolymorphicMapper.
+module;
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+export module metaprogramming.fixed_string;
+
+export extern "C++" {
+#include <FixedString.hpp>
+#include <PolymorphicMapper.hpp>
+}
@@ -0,0 +1,12 @@
+// Umbrella module: `import metaprogramming;` brings in every task area that
+// is offered as a module.
+//
+// task3 to task5 stay header-only for now. g++ 12 compiles their interfaces
+// but then either fails with an internal compiler error (Spy, the
+// thread_local lease in SpyTrace, Describe<T> users) or reads back corrupt
+// module data (EnumeratorTraits) as soon as an importer instantiates them.
+export module metaprogramming;
+
+export import metaprogramming.slice;
+export import metaprogramming.type_lists;
+export import metaprogramming.fixed_string;
@@ -0,0 +1,57 @@
+// task0: Slice.
+module;
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <span>
+#include <vector>
+
+export module metaprogramming.slice;
+
+export extern "C++" {
+#include <Slice.hpp>
+}
+
+namespace slice_module_detail {
+
+// The members a typical caller uses on a dynamic, unit-stride slice.
+// Instantiated here, they are stored in the compiled interface and
+// importers reuse them instead of instantiating them in every TU.
+template <class T>
+void Instantiate(std::vector<T> &values) {
+    Slice<T> slice(values);
+    Slice<const T> view(slice);
+    (void)slice.Size();
+    (void)slice.Data();
+    (void)slice[0];
+    (void)(slice == view);
+    for ([[maybe_unused]] T &value : slice) {
+    }
+    for (auto it = view.rbegin(); it != view.rend(); ++it) {
+    }
+    (void)slice.First(1);
+    (void)slice.Last(1);
+    (void)slice.DropFirst(1);
+    (void)slice.DropLast(1);
+    (void)slice.Skip(2);
+}
+
+template void Instantiate(std::vector<char> &);
+template void Instantiate(std::vector<signed char> &);
+template void Instantiate(std::vector<unsigned char> &);
+template void Instantiate(std::vector<short> &);
+template void Instantiate(std::vector<unsigned short> &);
+template void Instantiate(std::vector<int> &);
+template void Instantiate(std::vector<unsigned> &);
+template void Instantiate(std::vector<long> &);
+template void Instantiate(std::vector<unsigned long> &);
+template void Instantiate(std::vector<long long> &);
+template void Instantiate(std::vector<unsigned long long> &);
+template void Instantiate(std::vector<float> &);
+template void Instantiate(std::vector<double> &);
+template void Instantiate(std::vector<long double> &);
+
+} // namespace slice_module_detail
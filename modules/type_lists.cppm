@@ -0,0 +1,25 @@
+// task1: type tuples, type lists and the value sequences built on them.
+module;
+
+#include <concepts>
+#include <type_traits>
+
+export module metaprogramming.type_lists;
+
+export extern "C++" {
+#include <type_tuples.hpp>
+#include <type_lists.hpp>
+#include <value_types.hpp>
+#include <fun_value_sequences.hpp>
+}
+
+namespace type_lists_module_detail {
+
+// Walks prefixes of the infinite sequences, so the list nodes (and the
+// primality checks behind Primes) are stored in the compiled interface
+// and importers reuse them.
+static_assert(!std::is_void_v<type_lists::ToTuple<type_lists::Take<128, Nats>>>);
+static_assert(!std::is_void_v<type_lists::ToTuple<type_lists::Take<64, Primes>>>);
+static_assert(!std::is_void_v<type_lists::ToTuple<type_lists::Take<40, Fib>>>);
+
+} // namespace type_lists_module_detail
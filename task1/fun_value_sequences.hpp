@@ -1,5 +1,6 @@
 #pragma once
 
+#include <type_lists.hpp>
 #include <value_types.hpp>
 
 using namespace type_tuples;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <type_tuples.hpp>
 
 namespace value_types
 {
@@ -8,6 +9,6 @@ template<auto V>
 struct ValueTag{ static constexpr auto Value = V; };
 
 template<class T, T... ts>
-using VTuple = TTuple<ValueTag<ts>...>;
+using VTuple = type_tuples::TTuple<ValueTag<ts>...>;
 
 }
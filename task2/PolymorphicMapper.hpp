@@ -1,6 +1,9 @@
 #pragma once
 
+#include <concepts>
+#include <memory>
 #include <optional>
+#include <type_traits>
 
 template <class From, auto target>
 struct Mapping
@@ -1,36 +1,387 @@
 #pragma once
+#include <array>
+#include <atomic>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
 
-// Allocator is only used in bonus SBO tests,
-// ignore if you don't need bonus points.
-template <class T /*, class Allocator = std::allocator<std::byte>*/ >
+namespace spy_mode {
+
+// Accesses of one full expression are counted and reported as soon as the
+// expression ends. Not safe to use from several threads at once.
+struct Synchronous {};
+
+// Every thread counts its accesses in one of Slots cache-line-padded slots,
+// picked by thread ticket: an access is one read-modify-write on that slot,
+// uncontended unless another thread maps to the same slot. When an outermost
+// expression ends with BatchSize or more accesses pending in the slot, the
+// logger gets them under a per-Spy flag, so a thread calls the logger about
+// once per BatchSize accesses. Accesses still pending below BatchSize are
+// reported, summed over all slots, by Spy::flush() and the destructor.
+template <std::size_t Slots = 16, unsigned BatchSize = 256>
+  requires(Slots > 0 && BatchSize > 0)
+struct Concurrent {};
+
+// Counts every access like Synchronous, but only every N-th expression is
+// passed to the logger.
+template <unsigned N>
+  requires(N > 0)
+struct Sampled {};
+
+// Writes one event per expression into a per-thread ring buffer that
+// spy_trace::Writer drains in the background; the logger is not called.
+// Counting is per Spy as in Synchronous. Implemented in SpyTrace.hpp.
+struct Traced;
+
+// No instrumentation at all: operator-> returns T* and Spy<T, Disabled> has
+// the size of T.
+struct Disabled {};
+
+} // namespace spy_mode
+
+namespace spy_detail {
+
+inline constexpr std::size_t kCacheLine = 64;
+
+inline std::size_t ThreadTicket() noexcept {
+  static std::atomic<std::size_t> next{0};
+  thread_local const std::size_t ticket = next.fetch_add(1, std::memory_order_relaxed);
+  return ticket;
+}
+
+template <class Mode>
+class Counter;
+
+template <>
+class Counter<spy_mode::Synchronous> {
+public:
+  Counter() = default;
+  Counter(const Counter&) noexcept {}
+  Counter& operator =(const Counter&) noexcept { return *this; }
+
+  void enter() noexcept {
+    ++depth_;
+    ++count_;
+  }
+
+  template <class Report>
+  void leave(Report&& report) {
+    if (--depth_ == 0) {
+      report(std::exchange(count_, 0));
+    }
+  }
+
+  template <class Report>
+  void flush(Report&&) {
+  }
+
+private:
+  unsigned depth_ = 0;
+  unsigned count_ = 0;
+};
+
+template <std::size_t Slots, unsigned BatchSize>
+class Counter<spy_mode::Concurrent<Slots, BatchSize>> {
+public:
+  Counter() = default;
+  Counter(const Counter&) noexcept {}
+  Counter& operator =(const Counter&) noexcept { return *this; }
+
+  void enter() noexcept {
+    // Depth and count share one word, so an access is a single
+    // read-modify-write on the thread's slot.
+    slot().state.fetch_add(kOneAccess | 1, std::memory_order_relaxed);
+  }
+
+  template <class Report>
+  void leave(Report&& report) {
+    Slot& own = slot();
+    const std::uint64_t before = own.state.fetch_sub(1, std::memory_order_relaxed);
+    if ((before & kDepthMask) == 1 && (before >> kCountShift) >= BatchSize) {
+      drain(report, &own, &own + 1);
+    }
+  }
+
+  template <class Report>
+  void flush(Report&& report) {
+    drain(report, slots_.data(), slots_.data() + Slots);
+  }
+
+private:
+  static constexpr unsigned kCountShift = 32;
+  static constexpr std::uint64_t kOneAccess = std::uint64_t{1} << kCountShift;
+  static constexpr std::uint64_t kDepthMask = kOneAccess - 1;
+
+  struct alignas(kCacheLine) Slot {
+    std::atomic<std::uint64_t> state{0};
+  };
+
+  Slot& slot() noexcept {
+    return slots_[ThreadTicket() % Slots];
+  }
+
+  // Reports the counts pending in [first, last) as one logger call.
+  template <class Report>
+  void drain(Report& report, Slot* first, Slot* last) {
+    while (reporting_.test_and_set(std::memory_order_acquire)) {
+      reporting_.wait(true, std::memory_order_relaxed);
+    }
+    unsigned total = 0;
+    for (; first != last; ++first) {
+      Slot& slot = *first;
+      const std::uint64_t count = slot.state.load(std::memory_order_relaxed) >> kCountShift;
+      if (count != 0) {
+        slot.state.fetch_sub(count << kCountShift, std::memory_order_relaxed);
+        total += static_cast<unsigned>(count);
+      }
+    }
+    if (total != 0) {
+      report(total);
+    }
+    reporting_.clear(std::memory_order_release);
+    reporting_.notify_one();
+  }
+
+  std::array<Slot, Slots> slots_;
+  alignas(kCacheLine) std::atomic_flag reporting_;
+};
+
+template <unsigned N>
+class Counter<spy_mode::Sampled<N>> {
+public:
+  Counter() = default;
+  Counter(const Counter&) noexcept {}
+  Counter& operator =(const Counter&) noexcept { return *this; }
+
+  void enter() noexcept {
+    ++depth_;
+    ++count_;
+  }
+
+  template <class Report>
+  void leave(Report&& report) {
+    if (--depth_ != 0) {
+      return;
+    }
+    const unsigned count = std::exchange(count_, 0);
+    if (--countdown_ == 0) {
+      countdown_ = N;
+      report(count);
+    }
+  }
+
+  template <class Report>
+  void flush(Report&&) {
+  }
+
+private:
+  unsigned depth_ = 0;
+  unsigned count_ = 0;
+  unsigned countdown_ = N;
+};
+
+template <>
+class Counter<spy_mode::Disabled> {
+public:
+  template <class Report>
+  void flush(Report&&) {
+  }
+};
+
+class NoLogger {
+public:
+  template <class F>
+  void reset(F&&) noexcept {
+  }
+
+  void reset() noexcept {
+  }
+
+  void operator ()(unsigned int) const noexcept {
+  }
+};
+
+class Logger {
+public:
+  Logger() = default;
+
+  Logger(const Logger& other) : impl_(other.impl_ ? other.impl_->clone() : nullptr) {
+  }
+
+  Logger(Logger&&) noexcept = default;
+
+  Logger& operator =(const Logger& other) {
+    if (this != &other) {
+      impl_ = other.impl_ ? other.impl_->clone() : nullptr;
+    }
+    return *this;
+  }
+
+  Logger& operator =(Logger&&) noexcept = default;
+
+  template <class F>
+  void reset(F&& logger) {
+    impl_ = std::make_unique<Model<std::decay_t<F>>>(std::forward<F>(logger));
+  }
+
+  void reset() noexcept {
+    impl_.reset();
+  }
+
+  void operator ()(unsigned int count) const {
+    if (impl_) {
+      impl_->call(count);
+    }
+  }
+
+private:
+  struct Concept {
+    virtual ~Concept() = default;
+    virtual void call(unsigned int count) = 0;
+    virtual std::unique_ptr<Concept> clone() const = 0;
+  };
+
+  template <class F>
+  struct Model final : Concept {
+    template <class U>
+    explicit Model(U&& logger) : logger(std::forward<U>(logger)) {
+    }
+
+    void call(unsigned int count) override {
+      logger(count);
+    }
+
+    std::unique_ptr<Concept> clone() const override {
+      // Spy only copies its logger when T is copyable, and setLogger then
+      // only accepts copyable loggers.
+      if constexpr (std::copy_constructible<F>) {
+        return std::make_unique<Model>(logger);
+      } else {
+        std::abort();
+      }
+    }
+
+    F logger;
+  };
+
+  std::unique_ptr<Concept> impl_;
+};
+
+} // namespace spy_detail
+
+
+template <class T, class Mode = spy_mode::Synchronous>
 class Spy {
+  static constexpr bool kInstrumented = !std::same_as<Mode, spy_mode::Disabled>;
+
+  template <class Pointer>
+  class Proxy {
+  public:
+    Proxy(const Proxy&) = delete;
+    Proxy& operator =(const Proxy&) = delete;
+
+    ~Proxy() {
+      owner_->counter_.leave(owner_->logger_);
+    }
+
+    Pointer operator ->() const noexcept {
+      return pointer_;
+    }
+
+  private:
+    friend class Spy;
+
+    Proxy(const Spy* owner, Pointer pointer) noexcept : owner_(owner), pointer_(pointer) {
+      owner_->counter_.enter();
+    }
+
+    const Spy* owner_;
+    Pointer pointer_;
+  };
+
 public:
-  explicit Spy(T /* , const Allocator& alloc = Allocator()*/ );
+  Spy() requires std::default_initializable<T> = default;
+
+  explicit Spy(T value) : value_(std::move(value)) {
+  }
+
+  Spy(const Spy& other) requires std::copy_constructible<T>
+      : value_(other.value_), logger_(other.logger_) {
+  }
+
+  Spy(Spy&& other) requires std::move_constructible<T>
+      : value_(std::move(other.value_)), logger_(std::move(other.logger_)) {
+  }
+
+  Spy& operator =(const Spy& other) requires std::copyable<T> {
+    value_ = other.value_;
+    logger_ = other.logger_;
+    return *this;
+  }
+
+  Spy& operator =(Spy&& other) requires std::movable<T> {
+    value_ = std::move(other.value_);
+    logger_ = std::move(other.logger_);
+    return *this;
+  }
+
+  ~Spy() {
+    counter_.flush(logger_);
+  }
+
+  bool operator ==(const Spy& other) const requires std::equality_comparable<T> {
+    return value_ == other.value_;
+  }
+
+  T& operator *() {
+    return value_;
+  }
+
+  const T& operator *() const {
+    return value_;
+  }
+
+  Proxy<T*> operator ->() requires kInstrumented {
+    return Proxy<T*>(this, std::addressof(value_));
+  }
+
+  Proxy<const T*> operator ->() const requires kInstrumented {
+    return Proxy<const T*>(this, std::addressof(value_));
+  }
 
-  T& operator *();
-  const T& operator *() const;
+  T* operator ->() noexcept requires(!kInstrumented) {
+    return std::addressof(value_);
+  }
 
-  /* unspecified */ operator ->();
+  const T* operator ->() const noexcept requires(!kInstrumented) {
+    return std::addressof(value_);
+  }
 
-  /*
-   * if needed (see task readme):
-   *   default constructor
-   *   copy and move construction
-   *   copy and move assignment
-   *   equality operators
-   *   destructor
-  */
+  // Reports accesses that are still waiting in per-thread slots. Only useful
+  // with spy_mode::Concurrent; the other modes never hold pending counts.
+  void flush() {
+    counter_.flush(logger_);
+  }
 
   // Resets logger
-  void setLogger();
+  void setLogger() {
+    logger_.reset();
+  }
 
-  template <std::invocable<unsigned int> Logger> requires /* see task readme */
-  void setLogger(Logger&& logger);
+  template <std::invocable<unsigned int> Logger>
+    requires(!std::copy_constructible<T> || std::copy_constructible<std::decay_t<Logger>>) &&
+            (!std::move_constructible<T> || std::move_constructible<std::decay_t<Logger>>)
+  void setLogger(Logger&& logger) {
+    logger_.reset(std::forward<Logger>(logger));
+  }
 
 private:
   T value_;
-  // Allocator allocator_;
-  // Logger logger_; ???
-};
\ No newline at end of file
+  [[no_unique_address]] std::conditional_t<kInstrumented, spy_detail::Logger, spy_detail::NoLogger> logger_;
+  [[no_unique_address]] mutable spy_detail::Counter<Mode> counter_;
+};
@@ -0,0 +1,291 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <Spy.hpp>
+
+
+struct spy_mode::Traced {};
+
+namespace spy_trace {
+
+// One record of the trace file. The file starts with a 16 byte header:
+// the magic "SPYTRACE", the format version and sizeof(Event), both as
+// native-endian uint32, followed by the raw events.
+struct Event {
+  std::uint64_t timestamp;  // steady_clock, nanoseconds
+  std::uint64_t object_id;
+  std::uint32_t accesses;
+  std::uint32_t thread;  // in order of the thread's first event, never reused
+};
+static_assert(sizeof(Event) == 24);
+
+inline constexpr char kMagic[8] = {'S', 'P', 'Y', 'T', 'R', 'A', 'C', 'E'};
+inline constexpr std::uint32_t kVersion = 2;
+inline constexpr std::size_t kRingCapacity = 4096;
+
+// Single-producer single-consumer queue: the owning thread pushes, the
+// active Writer pops. Rings are never freed, a ring released by an exiting
+// thread is handed to the next thread that starts tracing.
+class Ring {
+public:
+  bool push(const Event& event) noexcept {
+    const std::uint64_t head = head_.load(std::memory_order_relaxed);
+    if (head - cached_tail_ == kRingCapacity) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head - cached_tail_ == kRingCapacity) {
+        dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+      }
+    }
+    events_[head % kRingCapacity] = event;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  template <class Sink>
+  void drain(Sink&& sink) {
+    const std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+    const std::uint64_t head = head_.load(std::memory_order_acquire);
+    const std::size_t first = tail % kRingCapacity;
+    const std::size_t count = head - tail;
+    const std::size_t wrapped = first + count > kRingCapacity ? first + count - kRingCapacity : 0;
+    sink(events_ + first, count - wrapped);
+    sink(events_, wrapped);
+    tail_.store(head, std::memory_order_release);
+  }
+
+  std::uint64_t dropped() const noexcept {
+    return dropped_.load(std::memory_order_relaxed);
+  }
+
+private:
+  friend class Registry;
+
+  alignas(spy_detail::kCacheLine) std::atomic<std::uint64_t> head_{0};
+  std::uint64_t cached_tail_ = 0;
+  std::atomic<std::uint64_t> dropped_{0};
+  alignas(spy_detail::kCacheLine) std::atomic<std::uint64_t> tail_{0};
+  alignas(spy_detail::kCacheLine) std::atomic<bool> owned_{true};
+  Ring* next_ = nullptr;
+  Event events_[kRingCapacity];
+};
+
+// Lock-free list of every ring ever created.
+class Registry {
+public:
+  static Registry& instance() {
+    static Registry registry;
+    return registry;
+  }
+
+  // Returns null if a new ring is needed and cannot be allocated.
+  Ring* acquire() noexcept {
+    for (Ring* ring = head_.load(std::memory_order_acquire); ring != nullptr; ring = ring->next_) {
+      if (!ring->owned_.exchange(true, std::memory_order_acquire)) {
+        return ring;
+      }
+    }
+    Ring* ring = new (std::nothrow) Ring;
+    if (ring == nullptr) {
+      return nullptr;
+    }
+    ring->next_ = head_.load(std::memory_order_relaxed);
+    while (!head_.compare_exchange_weak(ring->next_, ring, std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+    return ring;
+  }
+
+  void release(Ring* ring) noexcept {
+    ring->owned_.store(false, std::memory_order_release);
+  }
+
+  template <class F>
+  void forEach(F&& f) {
+    for (Ring* ring = head_.load(std::memory_order_acquire); ring != nullptr; ring = ring->next_) {
+      f(*ring);
+    }
+  }
+
+private:
+  std::atomic<Ring*> head_{nullptr};
+};
+
+// The calling thread's ring, or null if it has none and there is no memory
+// for one; the next call tries again.
+inline Ring* ThreadRing() noexcept {
+  struct Lease {
+    Ring* ring = nullptr;
+
+    ~Lease() {
+      if (ring != nullptr) {
+        Registry::instance().release(ring);
+      }
+    }
+  };
+  thread_local Lease lease;
+  if (lease.ring == nullptr) {
+    lease.ring = Registry::instance().acquire();
+  }
+  return lease.ring;
+}
+
+inline std::uint32_t ThreadId() noexcept {
+  static std::atomic<std::uint32_t> next{0};
+  thread_local const std::uint32_t id = next.fetch_add(1, std::memory_order_relaxed);
+  return id;
+}
+
+inline std::uint64_t NextObjectId() noexcept {
+  static std::atomic<std::uint64_t> next{0};
+  return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+// The event is dropped if the thread has no ring.
+inline void Record(std::uint64_t object_id, unsigned accesses) noexcept {
+  Ring* ring = ThreadRing();
+  if (ring == nullptr) {
+    return;
+  }
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  ring->push(Event{
+      static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()),
+      object_id, accesses, ThreadId()});
+}
+
+// Background thread that periodically moves events from all rings to a file.
+// At most one Writer may exist at a time; events recorded while there is
+// none stay in the rings until they fill up, then new events are dropped.
+class Writer {
+public:
+  explicit Writer(const char* path, std::chrono::milliseconds period = std::chrono::milliseconds(10))
+      : period_(period) {
+    if (active().exchange(true, std::memory_order_acquire)) {
+      throw std::logic_error("spy_trace::Writer is already active");
+    }
+    file_ = std::fopen(path, "wb");
+    if (file_ == nullptr) {
+      active().store(false, std::memory_order_release);
+      throw std::runtime_error("spy_trace::Writer cannot open trace file");
+    }
+    const std::uint32_t header[2] = {kVersion, sizeof(Event)};
+    std::fwrite(kMagic, sizeof(kMagic), 1, file_);
+    std::fwrite(header, sizeof(header), 1, file_);
+    batch_.reserve(kBatchSize);
+    worker_ = std::jthread([this](std::stop_token stop) { run(stop); });
+  }
+
+  Writer(const Writer&) = delete;
+  Writer& operator =(const Writer&) = delete;
+
+  ~Writer() {
+    worker_.request_stop();
+    worker_.join();
+    drain();
+    std::fclose(file_);
+    active().store(false, std::memory_order_release);
+  }
+
+  std::uint64_t written() const noexcept {
+    return written_.load(std::memory_order_relaxed);
+  }
+
+  std::uint64_t dropped() const {
+    std::uint64_t dropped = 0;
+    Registry::instance().forEach([&](const Ring& ring) { dropped += ring.dropped(); });
+    return dropped;
+  }
+
+private:
+  static constexpr std::size_t kBatchSize = 1024;
+
+  static std::atomic<bool>& active() {
+    static std::atomic<bool> active{false};
+    return active;
+  }
+
+  void run(std::stop_token stop) {
+    std::mutex mutex;
+    std::condition_variable_any wakeup;
+    while (!stop.stop_requested()) {
+      drain();
+      std::unique_lock lock(mutex);
+      wakeup.wait_for(lock, stop, period_, [] { return false; });
+    }
+  }
+
+  void drain() {
+    Registry::instance().forEach([this](Ring& ring) {
+      ring.drain([this](const Event* events, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+          batch_.push_back(events[i]);
+          if (batch_.size() == kBatchSize) {
+            flush();
+          }
+        }
+      });
+    });
+    flush();
+    std::fflush(file_);
+  }
+
+  void flush() {
+    std::fwrite(batch_.data(), sizeof(Event), batch_.size(), file_);
+    written_.fetch_add(batch_.size(), std::memory_order_relaxed);
+    batch_.clear();
+  }
+
+  std::FILE* file_ = nullptr;
+  std::chrono::milliseconds period_;
+  std::vector<Event> batch_;
+  std::atomic<std::uint64_t> written_{0};
+  std::jthread worker_;
+};
+
+} // namespace spy_trace
+
+template <>
+class spy_detail::Counter<spy_mode::Traced> {
+public:
+  Counter() noexcept : id_(spy_trace::NextObjectId()) {
+  }
+
+  Counter(const Counter&) noexcept : Counter() {
+  }
+
+  Counter& operator =(const Counter&) noexcept {
+    return *this;
+  }
+
+  void enter() noexcept {
+    ++depth_;
+    ++count_;
+  }
+
+  template <class Report>
+  void leave(Report&&) noexcept {
+    if (--depth_ == 0) {
+      spy_trace::Record(id_, std::exchange(count_, 0));
+    }
+  }
+
+  template <class Report>
+  void flush(Report&&) {
+  }
+
+private:
+  std::uint64_t id_;
+  unsigned depth_ = 0;
+  unsigned count_ = 0;
+};
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include <EnumeratorTraits.hpp>
+
+
+// A value for every enumerator of Enum, stored in a flat array indexed by
+// the enumerator's ordinal in EnumeratorTraits. All keys are always present;
+// a default-constructed map holds value-initialized values.
+template <class Enum, class V, std::size_t MAXN = 512>
+    requires std::is_enum_v<Enum>
+class EnumMap
+{
+public:
+    using Traits = EnumeratorTraits<Enum, MAXN>;
+    using key_type = Enum;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using Value = std::conditional_t<Const, const V, V>;
+        using value_type = std::pair<Enum, Value &>;
+        using reference = value_type;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+
+        constexpr Iterator() = default;
+
+        constexpr Iterator(Value *values, std::size_t i) : values_(values), i_(i)
+        {
+        }
+
+        constexpr reference operator*() const
+        {
+            return {Traits::at(i_), values_[i_]};
+        }
+
+        constexpr Iterator &operator++()
+        {
+            ++i_;
+            return *this;
+        }
+
+        constexpr Iterator operator++(int)
+        {
+            Iterator copy = *this;
+            ++i_;
+            return copy;
+        }
+
+        constexpr bool operator==(const Iterator &other) const
+        {
+            return i_ == other.i_;
+        }
+
+    private:
+        Value *values_ = nullptr;
+        std::size_t i_ = 0;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    static constexpr size_type size() noexcept
+    {
+        return Traits::size();
+    }
+
+    static constexpr bool contains(Enum key) noexcept
+    {
+        return Traits::indexOf(key) < size();
+    }
+
+    // key must be an enumerator.
+    constexpr V &operator[](Enum key) noexcept
+    {
+        return values_[Traits::indexOf(key)];
+    }
+
+    constexpr const V &operator[](Enum key) const noexcept
+    {
+        return values_[Traits::indexOf(key)];
+    }
+
+    constexpr V &at(Enum key)
+    {
+        return values_[Checked(key)];
+    }
+
+    constexpr const V &at(Enum key) const
+    {
+        return values_[Checked(key)];
+    }
+
+    constexpr void fill(const V &value)
+    {
+        values_.fill(value);
+    }
+
+    constexpr V *data() noexcept
+    {
+        return values_.data();
+    }
+
+    constexpr const V *data() const noexcept
+    {
+        return values_.data();
+    }
+
+    constexpr iterator begin() noexcept
+    {
+        return {values_.data(), 0};
+    }
+
+    constexpr iterator end() noexcept
+    {
+        return {values_.data(), size()};
+    }
+
+    constexpr const_iterator begin() const noexcept
+    {
+        return {values_.data(), 0};
+    }
+
+    constexpr const_iterator end() const noexcept
+    {
+        return {values_.data(), size()};
+    }
+
+    friend constexpr bool operator==(const EnumMap &, const EnumMap &) = default;
+
+private:
+    static constexpr std::size_t Checked(Enum key)
+    {
+        const std::size_t i = Traits::indexOf(key);
+        if (i == size())
+        {
+            throw std::out_of_range("EnumMap::at: not an enumerator");
+        }
+        return i;
+    }
+
+    std::array<V, Traits::size()> values_{};
+};
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+
+#include <EnumeratorTraits.hpp>
+
+
+// A set of enumerators of Enum stored as a bitset: bit i stands for the
+// enumerator with ordinal i in EnumeratorTraits. Iteration visits members in
+// ascending order of their values.
+template <class Enum, std::size_t MAXN = 512>
+    requires std::is_enum_v<Enum>
+class EnumSet
+{
+public:
+    using Traits = EnumeratorTraits<Enum, MAXN>;
+    using value_type = Enum;
+    using size_type = std::size_t;
+
+    class Iterator
+    {
+    public:
+        using value_type = Enum;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+
+        constexpr Iterator() = default;
+
+        constexpr Iterator(const EnumSet *set, std::size_t i) : set_(set), i_(set->Next(i))
+        {
+        }
+
+        constexpr Enum operator*() const
+        {
+            return Traits::at(i_);
+        }
+
+        constexpr Iterator &operator++()
+        {
+            i_ = set_->Next(i_ + 1);
+            return *this;
+        }
+
+        constexpr Iterator operator++(int)
+        {
+            Iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        constexpr bool operator==(const Iterator &other) const
+        {
+            return i_ == other.i_;
+        }
+
+    private:
+        const EnumSet *set_ = nullptr;
+        std::size_t i_ = 0;
+    };
+
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+    constexpr EnumSet() = default;
+
+    constexpr EnumSet(std::initializer_list<Enum> values)
+    {
+        for (const Enum value : values)
+        {
+            insert(value);
+        }
+    }
+
+    static constexpr EnumSet all() noexcept
+    {
+        EnumSet set;
+        set.words_.fill(~Word{0});
+        set.Trim();
+        return set;
+    }
+
+    static constexpr size_type capacity() noexcept
+    {
+        return Traits::size();
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        size_type count = 0;
+        for (const Word word : words_)
+        {
+            count += static_cast<size_type>(std::popcount(word));
+        }
+        return count;
+    }
+
+    constexpr bool empty() const noexcept
+    {
+        for (const Word word : words_)
+        {
+            if (word != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr bool contains(Enum value) const noexcept
+    {
+        const std::size_t i = Traits::indexOf(value);
+        return i < capacity() && (words_[i / kBits] >> (i % kBits) & 1) != 0;
+    }
+
+    // Returns false if value was already present or is not an enumerator.
+    constexpr bool insert(Enum value) noexcept
+    {
+        const std::size_t i = Traits::indexOf(value);
+        if (i == capacity())
+        {
+            return false;
+        }
+        const Word bit = Word{1} << (i % kBits);
+        const bool inserted = (words_[i / kBits] & bit) == 0;
+        words_[i / kBits] |= bit;
+        return inserted;
+    }
+
+    // Returns whether value was present.
+    constexpr bool erase(Enum value) noexcept
+    {
+        const std::size_t i = Traits::indexOf(value);
+        if (i == capacity())
+        {
+            return false;
+        }
+        const Word bit = Word{1} << (i % kBits);
+        const bool erased = (words_[i / kBits] & bit) != 0;
+        words_[i / kBits] &= ~bit;
+        return erased;
+    }
+
+    constexpr void clear() noexcept
+    {
+        words_.fill(0);
+    }
+
+    constexpr iterator begin() const noexcept
+    {
+        return {this, 0};
+    }
+
+    constexpr iterator end() const noexcept
+    {
+        return {this, capacity()};
+    }
+
+    constexpr EnumSet &operator|=(const EnumSet &other) noexcept
+    {
+        for (std::size_t w = 0; w < kWords; ++w)
+        {
+            words_[w] |= other.words_[w];
+        }
+        return *this;
+    }
+
+    constexpr EnumSet &operator&=(const EnumSet &other) noexcept
+    {
+        for (std::size_t w = 0; w < kWords; ++w)
+        {
+            words_[w] &= other.words_[w];
+        }
+        return *this;
+    }
+
+    constexpr EnumSet &operator^=(const EnumSet &other) noexcept
+    {
+        for (std::size_t w = 0; w < kWords; ++w)
+        {
+            words_[w] ^= other.words_[w];
+        }
+        return *this;
+    }
+
+    friend constexpr EnumSet operator|(EnumSet lhs, const EnumSet &rhs) noexcept
+    {
+        return lhs |= rhs;
+    }
+
+    friend constexpr EnumSet operator&(EnumSet lhs, const EnumSet &rhs) noexcept
+    {
+        return lhs &= rhs;
+    }
+
+    friend constexpr EnumSet operator^(EnumSet lhs, const EnumSet &rhs) noexcept
+    {
+        return lhs ^= rhs;
+    }
+
+    // Complement with respect to all enumerators.
+    friend constexpr EnumSet operator~(EnumSet set) noexcept
+    {
+        for (Word &word : set.words_)
+        {
+            word = ~word;
+        }
+        set.Trim();
+        return set;
+    }
+
+    friend constexpr bool operator==(const EnumSet &, const EnumSet &) = default;
+
+private:
+    using Word = std::uint64_t;
+
+    static constexpr std::size_t kBits = 64;
+    static constexpr std::size_t kWords = (Traits::size() + kBits - 1) / kBits;
+
+    // Clears the bits past the last enumerator.
+    constexpr void Trim() noexcept
+    {
+        if constexpr (capacity() % kBits != 0)
+        {
+            words_.back() &= (Word{1} << (capacity() % kBits)) - 1;
+        }
+    }
+
+    // Ordinal of the first member at or after i, or capacity().
+    constexpr std::size_t Next(std::size_t i) const noexcept
+    {
+        std::size_t w = i / kBits;
+        if (w >= kWords)
+        {
+            return capacity();
+        }
+        Word word = words_[w] & (~Word{0} << (i % kBits));
+        while (word == 0)
+        {
+            if (++w == kWords)
+            {
+                return capacity();
+            }
+            word = words_[w];
+        }
+        return w * kBits + static_cast<std::size_t>(std::countr_zero(word));
+    }
+
+    std::array<Word, kWords> words_{};
+};
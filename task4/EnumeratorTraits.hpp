@@ -1,13 +1,468 @@
 #pragma once
 
-#include <type_traits>
+#include <array>
+#include <bit>
 #include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+
+namespace enumerator_traits_detail
+{
+
+// Candidate values are probed kChunk at a time: one instantiation of
+// Signature per chunk prints the whole pack, and chunk boundaries are
+// multiples of kChunk, so chunks are shared by every MAXN of the same enum.
+inline constexpr std::size_t kChunk = 64;
+
+template <auto... Values>
+constexpr std::string_view Signature() noexcept
+{
+    return __PRETTY_FUNCTION__;
+}
+
+struct ChunkProbe
+{
+    std::size_t count = 0;
+    std::array<std::uint8_t, kChunk> offsets{};
+    std::array<std::string_view, kChunk> names{};
+};
+
+constexpr bool IsDigit(char c)
+{
+    return '0' <= c && c <= '9';
+}
+
+// A printed pack element is either an enumerator ("ns::E::Name") or the
+// value of a cast ("(ns::E)17" with GCC, "17" with older Clang).
+constexpr bool IsEnumerator(std::string_view element)
+{
+    if (element.empty() || IsDigit(element.front()) || element.front() == '-')
+    {
+        return false;
+    }
+    if (element.front() != '(')
+    {
+        return true;
+    }
+    int depth = 0;
+    for (std::size_t i = 0; i < element.size(); ++i)
+    {
+        depth += element[i] == '(';
+        depth -= element[i] == ')';
+        if (depth == 0)
+        {
+            return i + 1 < element.size() && !IsDigit(element[i + 1]) && element[i + 1] != '-';
+        }
+    }
+    return false;
+}
+
+constexpr std::string_view Unqualified(std::string_view name)
+{
+    const std::size_t scope = name.rfind("::");
+    return scope == std::string_view::npos ? name : name.substr(scope + 2);
+}
+
+// GCC: "... [with auto ...Values = {E::A, (E)1, E::B}; ...]"
+// Clang: "... [Values = <E::A, (E)1, E::B>]"
+constexpr ChunkProbe ParseChunk(std::string_view signature)
+{
+    ChunkProbe probe;
+    constexpr std::string_view kPack = "Values = ";
+    std::size_t pos = signature.find(kPack) + kPack.size() + 1;
+    std::size_t begin = pos;
+    std::size_t offset = 0;
+    for (int depth = 0; offset < kChunk; ++pos)
+    {
+        const char c = signature[pos];
+        if (depth == 0 && (c == ',' || c == '}' || c == '>'))
+        {
+            const std::string_view element = signature.substr(begin, pos - begin);
+            if (IsEnumerator(element))
+            {
+                probe.offsets[probe.count] = static_cast<std::uint8_t>(offset);
+                probe.names[probe.count] = Unqualified(element);
+                ++probe.count;
+            }
+            ++offset;
+            begin = pos + 2;
+            continue;
+        }
+        depth += c == '(' || c == '<' || c == '{';
+        depth -= c == ')' || c == '>' || c == '}';
+    }
+    return probe;
+}
+
+template <class Enum, std::intmax_t Begin, std::size_t... Is>
+constexpr ChunkProbe ProbeChunk(std::index_sequence<Is...>)
+{
+    using Underlying = std::underlying_type_t<Enum>;
+    return ParseChunk(Signature<static_cast<Enum>(static_cast<Underlying>(Begin + Is))...>());
+}
+
+template <class Enum, std::intmax_t Begin>
+inline constexpr ChunkProbe kChunkProbe =
+    ProbeChunk<Enum, Begin>(std::make_index_sequence<kChunk>{});
+
+// std::cmp_less and friends reject bool and the character types, which are
+// valid underlying types, so values are widened before they are compared.
+template <class Underlying>
+constexpr auto Widen(Underlying u)
+{
+    if constexpr (std::is_signed_v<Underlying>)
+    {
+        return static_cast<std::intmax_t>(u);
+    }
+    else
+    {
+        return static_cast<std::uintmax_t>(u);
+    }
+}
+
+// Probed range: [-MAXN, MAXN] narrowed to the bounds of the underlying type.
+template <class Enum, std::size_t MAXN>
+struct Range
+{
+    using Underlying = std::underlying_type_t<Enum>;
+    using Limits = std::numeric_limits<Underlying>;
+
+    static constexpr std::intmax_t min =
+        std::cmp_less(Widen(Limits::min()), -static_cast<std::intmax_t>(MAXN))
+            ? -static_cast<std::intmax_t>(MAXN)
+            : static_cast<std::intmax_t>(Limits::min());
+    static constexpr std::intmax_t max =
+        std::cmp_greater(Widen(Limits::max()), MAXN)
+            ? static_cast<std::intmax_t>(MAXN)
+            : static_cast<std::intmax_t>(Limits::max());
+
+    static constexpr std::intmax_t first_chunk =
+        (min >= 0 ? min : min - static_cast<std::intmax_t>(kChunk) + 1) /
+        static_cast<std::intmax_t>(kChunk) * static_cast<std::intmax_t>(kChunk);
+    static constexpr std::size_t num_chunks =
+        static_cast<std::size_t>(max - first_chunk) / kChunk + 1;
+};
+
+template <class Enum, std::size_t MAXN, class F>
+constexpr void ForEachEnumerator(F &&f)
+{
+    using R = Range<Enum, MAXN>;
+    [&]<std::size_t... Cs>(std::index_sequence<Cs...>)
+    {
+        ([&]
+         {
+             constexpr std::intmax_t begin = R::first_chunk + static_cast<std::intmax_t>(Cs * kChunk);
+             constexpr const ChunkProbe &probe = kChunkProbe<Enum, begin>;
+             for (std::size_t i = 0; i < probe.count; ++i)
+             {
+                 const std::intmax_t value = begin + probe.offsets[i];
+                 if (R::min <= value && value <= R::max)
+                 {
+                     f(value, probe.names[i]);
+                 }
+             } }(),
+         ...);
+    }(std::make_index_sequence<R::num_chunks>{});
+}
+
+struct Summary
+{
+    std::size_t count = 0;
+    std::size_t chars = 0;
+};
+
+template <class Enum, std::size_t MAXN>
+constexpr Summary Summarize()
+{
+    Summary summary;
+    ForEachEnumerator<Enum, MAXN>([&](std::intmax_t, std::string_view name)
+                                  {
+        ++summary.count;
+        summary.chars += name.size(); });
+    return summary;
+}
+
+// Smallest unsigned type that holds every value in [0, Max].
+template <std::size_t Max>
+using UintFor = std::conditional_t<
+    Max <= std::numeric_limits<std::uint8_t>::max(), std::uint8_t,
+    std::conditional_t<Max <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t,
+                       std::uint32_t>>;
+
+// Names are packed back to back into one blob; name i is
+// blob[offsets[i], offsets[i + 1]). Values are sorted in ascending order.
+template <class Enum, std::size_t N, std::size_t Chars>
+struct Table
+{
+    std::array<Enum, N> values{};
+    std::array<UintFor<Chars>, N + 1> offsets{};
+    std::array<char, Chars> blob{};
+
+    constexpr std::string_view name(std::size_t i) const
+    {
+        return {blob.data() + offsets[i], static_cast<std::size_t>(offsets[i + 1] - offsets[i])};
+    }
+};
+
+template <class Enum, std::size_t MAXN>
+constexpr auto BuildTable()
+{
+    constexpr Summary kSummary = Summarize<Enum, MAXN>();
+    Table<Enum, kSummary.count, kSummary.chars> table;
+    std::size_t i = 0;
+    std::size_t chars = 0;
+    ForEachEnumerator<Enum, MAXN>([&](std::intmax_t value, std::string_view name)
+                                  {
+        table.values[i] = static_cast<Enum>(static_cast<std::underlying_type_t<Enum>>(value));
+        for (const char c : name)
+        {
+            table.blob[chars++] = c;
+        }
+        table.offsets[++i] = static_cast<UintFor<kSummary.chars>>(chars); });
+    return table;
+}
+
+// Computed once per (Enum, MAXN) and shared by every user of the traits.
+template <class Enum, std::size_t MAXN>
+inline constexpr auto kTable = BuildTable<Enum, MAXN>();
 
+// Value -> ordinal. Enumerators spanning at most kDenseFactor slots per
+// enumerator get a direct lookup array; sparser enums binary search the
+// sorted values instead.
+inline constexpr std::size_t kDenseFactor = 4;
+
+template <class Enum, std::size_t MAXN>
+struct ValueIndex;
+
+template <class Enum, std::size_t MAXN>
+inline constexpr auto kDenseOrdinals = ValueIndex<Enum, MAXN>::BuildDense();
+
+template <class Enum, std::size_t MAXN>
+struct ValueIndex
+{
+    using Underlying = std::underlying_type_t<Enum>;
+
+    static constexpr const auto &table = kTable<Enum, MAXN>;
+    static constexpr std::size_t size = table.values.size();
+    static constexpr std::intmax_t lo = size == 0 ? 0 : static_cast<std::intmax_t>(static_cast<Underlying>(table.values.front()));
+    static constexpr std::intmax_t hi = size == 0 ? -1 : static_cast<std::intmax_t>(static_cast<Underlying>(table.values.back()));
+    static constexpr std::size_t span = static_cast<std::size_t>(hi - lo + 1);
+    static constexpr bool dense = span <= kDenseFactor * size;
+
+    using Ordinal = UintFor<size>;
+
+    static constexpr auto BuildDense()
+    {
+        std::array<Ordinal, span> ordinals{};
+        ordinals.fill(static_cast<Ordinal>(size));
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            ordinals[static_cast<std::size_t>(static_cast<Underlying>(table.values[i]) - lo)] = static_cast<Ordinal>(i);
+        }
+        return ordinals;
+    }
+
+    static constexpr std::size_t Find(Enum value) noexcept
+    {
+        const Underlying u = static_cast<Underlying>(value);
+        if (std::cmp_less(Widen(u), lo) || std::cmp_greater(Widen(u), hi))
+        {
+            return size;
+        }
+        if constexpr (dense)
+        {
+            return kDenseOrdinals<Enum, MAXN>[static_cast<std::size_t>(static_cast<std::intmax_t>(u) - lo)];
+        }
+        else
+        {
+            std::size_t first = 0;
+            std::size_t count = size;
+            while (count > 0)
+            {
+                const std::size_t half = count / 2;
+                if (static_cast<Underlying>(table.values[first + half]) < u)
+                {
+                    first += half + 1;
+                    count -= half + 1;
+                }
+                else
+                {
+                    count = half;
+                }
+            }
+            return first < size && table.values[first] == value ? first : size;
+        }
+    }
+};
+
+// FNV-1a followed by a splitmix64 finalizer. Name lookups hash the string
+// once; the per-bucket seed is mixed into that hash afterwards.
+constexpr std::uint64_t Mix(std::uint64_t h)
+{
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ull;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebull;
+    h ^= h >> 31;
+    return h;
+}
+
+constexpr std::uint64_t HashName(std::string_view name)
+{
+    std::uint64_t h = 0xcbf29ce484222325ull;
+    for (const char c : name)
+    {
+        h ^= static_cast<unsigned char>(c);
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+constexpr std::uint64_t Displace(std::uint64_t hash, std::uint32_t seed)
+{
+    return Mix(hash + seed * 0x9e3779b97f4a7c15ull);
+}
+
+// Name -> ordinal through a hash-and-displace perfect hash: a name's hash
+// picks a bucket, the bucket's seed displaces it into a slot that no other
+// enumerator occupies. Buckets hold about four names and at most three
+// quarters of the slots are used, so seeds are found in a few tries.
+template <class Enum, std::size_t MAXN>
+struct NameIndex
+{
+    static constexpr const auto &table = kTable<Enum, MAXN>;
+    static constexpr std::size_t size = table.values.size();
+    static constexpr std::size_t num_buckets = size / 4 + 1;
+    static constexpr std::size_t num_slots = std::bit_ceil(size + size / 3 + 1);
+
+    using Ordinal = UintFor<size>;
+
+    struct Hash
+    {
+        std::array<std::uint32_t, num_buckets> seeds{};
+        std::array<Ordinal, num_slots> ordinals{};
+    };
+
+    static constexpr Hash Build()
+    {
+        Hash hash;
+        hash.ordinals.fill(static_cast<Ordinal>(size));
+
+        std::array<std::uint64_t, size> hashes{};
+        std::array<std::size_t, num_buckets> bucket_size{};
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hashes[i] = HashName(table.name(i));
+            ++bucket_size[hashes[i] % num_buckets];
+        }
+
+        // Largest buckets first, while most slots are still free.
+        std::array<std::size_t, num_buckets> order{};
+        for (std::size_t b = 0; b < num_buckets; ++b)
+        {
+            std::size_t j = b;
+            for (; j > 0 && bucket_size[order[j - 1]] < bucket_size[b]; --j)
+            {
+                order[j] = order[j - 1];
+            }
+            order[j] = b;
+        }
+
+        std::array<std::size_t, size> members{};
+        std::array<std::size_t, size> slots{};
+        for (const std::size_t b : order)
+        {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (hashes[i] % num_buckets == b)
+                {
+                    members[count++] = i;
+                }
+            }
+            for (std::uint32_t seed = 0;; ++seed)
+            {
+                bool fits = true;
+                for (std::size_t k = 0; k < count && fits; ++k)
+                {
+                    slots[k] = Displace(hashes[members[k]], seed) & (num_slots - 1);
+                    fits = hash.ordinals[slots[k]] == size;
+                    for (std::size_t m = 0; m < k && fits; ++m)
+                    {
+                        fits = slots[m] != slots[k];
+                    }
+                }
+                if (fits)
+                {
+                    hash.seeds[b] = seed;
+                    for (std::size_t k = 0; k < count; ++k)
+                    {
+                        hash.ordinals[slots[k]] = static_cast<Ordinal>(members[k]);
+                    }
+                    break;
+                }
+            }
+        }
+        return hash;
+    }
+
+    static constexpr Hash kHash = Build();
+
+    static constexpr std::size_t Find(std::string_view name) noexcept
+    {
+        const std::uint64_t h = HashName(name);
+        const std::size_t slot = Displace(h, kHash.seeds[h % num_buckets]) & (num_slots - 1);
+        const std::size_t i = kHash.ordinals[slot];
+        return i < size && table.name(i) == name ? i : size;
+    }
+};
+
+} // namespace enumerator_traits_detail
 
 template <class Enum, std::size_t MAXN = 512>
 	requires std::is_enum_v<Enum>
 struct EnumeratorTraits {
-    static constexpr std::size_t size() noexcept;
-    static constexpr Enum at(std::size_t i) noexcept;
-    static constexpr std::string_view nameAt(std::size_t i) noexcept;
+    static constexpr std::size_t size() noexcept
+    {
+        return enumerator_traits_detail::kTable<Enum, MAXN>.values.size();
+    }
+
+    static constexpr Enum at(std::size_t i) noexcept
+    {
+        return enumerator_traits_detail::kTable<Enum, MAXN>.values[i];
+    }
+
+    static constexpr std::string_view nameAt(std::size_t i) noexcept
+    {
+        return enumerator_traits_detail::kTable<Enum, MAXN>.name(i);
+    }
+
+    // Ordinal of value, or size() if value is not an enumerator.
+    static constexpr std::size_t indexOf(Enum value) noexcept
+    {
+        return enumerator_traits_detail::ValueIndex<Enum, MAXN>::Find(value);
+    }
+
+    // Name of value, or an empty string if value is not an enumerator.
+    static constexpr std::string_view nameOf(Enum value) noexcept
+    {
+        const std::size_t i = indexOf(value);
+        return i < size() ? nameAt(i) : std::string_view{};
+    }
+
+    // Ordinal of the enumerator called name, or size() if there is none.
+    static constexpr std::size_t indexOfName(std::string_view name) noexcept
+    {
+        return enumerator_traits_detail::NameIndex<Enum, MAXN>::Find(name);
+    }
+
+    static constexpr std::optional<Enum> fromName(std::string_view name) noexcept
+    {
+        const std::size_t i = indexOfName(name);
+        return i < size() ? std::optional<Enum>{at(i)} : std::nullopt;
+    }
 };
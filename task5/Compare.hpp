@@ -0,0 +1,315 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include <reflect.hpp>
+
+
+// Equality, three-way comparison and hashing generated from Describe<T>.
+//
+// Fields are compared in declaration order; fields annotated with
+// compare::Ignore take no part in any of them. Adjacent fields with unique
+// object representations (integers, enums, pointers and aggregates of those
+// without padding) that touch each other in memory form a run: equality
+// compares a run with one memcmp and hashing mixes it 8 bytes at a time.
+// Ordering stays field by field, since memcmp order is not the numeric
+// order of multi-byte integers on little-endian targets.
+namespace compare {
+
+struct Ignore {};
+
+namespace detail {
+
+using reflect_detail::Field;
+using reflect_detail::kIsInstance;
+using reflect_detail::kIsStdArray;
+
+// Aggregates handled through their fields rather than their own operators.
+template <class U>
+concept Reflected = std::is_class_v<U> && std::is_aggregate_v<U> && !kIsStdArray<U>;
+
+// Whether comparing U has to look inside it because it is, or holds, a
+// Reflected type: ranges and optionals of those are compared element by
+// element. Everything else uses its own == and <=>.
+template <class U>
+constexpr bool HoldsReflected() {
+    if constexpr (Reflected<U>) {
+        return true;
+    } else if constexpr (kIsInstance<std::optional, U>) {
+        return HoldsReflected<typename U::value_type>();
+    } else if constexpr (std::ranges::range<U>) {
+        using Element = std::remove_cvref_t<std::ranges::range_reference_t<const U &>>;
+        if constexpr (std::is_same_v<Element, U>) {
+            return false;
+        } else {
+            return HoldsReflected<Element>();
+        }
+    } else {
+        return false;
+    }
+}
+
+// Contiguous elements that can be hashed as bytes. A concept, so that
+// range_value_t is only formed for ranges.
+template <class U>
+concept BytewiseRange = std::ranges::contiguous_range<U> &&
+                        std::has_unique_object_representations_v<std::ranges::range_value_t<U>>;
+
+template <class T, std::size_t I>
+inline constexpr bool kIgnored = Field<T, I>::template has_annotation_class<Ignore>;
+
+template <class T, std::size_t I>
+struct Bitwise
+    : std::bool_constant<!kIgnored<T, I> && std::has_unique_object_representations_v<typename Field<T, I>::Type>> {};
+
+// Bitwise fields covering T without a gap leave no padding, so the whole
+// object is compared and hashed as a block.
+template <class T>
+using Runs = reflect_detail::Runs<T, Bitwise>;
+
+inline constexpr std::uint64_t kMultiplier = 0x9e3779b97f4a7c15ull;
+
+inline std::uint64_t Mix(std::uint64_t h) {
+    h ^= h >> 32;
+    h *= 0xd6e8feb86659fd93ull;
+    h ^= h >> 32;
+    return h;
+}
+
+class Hasher {
+public:
+    void Word(std::uint64_t word) noexcept {
+        state_ = (std::rotl(state_, 23) ^ word) * kMultiplier;
+    }
+
+    // Mixes size bytes 8 at a time; the tail goes into one zero-padded
+    // word together with the length.
+    void Bytes(const void *data, std::size_t size) noexcept {
+        const auto *bytes = static_cast<const unsigned char *>(data);
+        for (; size >= 8; size -= 8, bytes += 8) {
+            std::uint64_t word;
+            std::memcpy(&word, bytes, 8);
+            Word(word);
+        }
+        std::uint64_t tail = 0;
+        if (size != 0) {
+            std::memcpy(&tail, bytes, size);
+        }
+        Word(tail ^ (std::uint64_t{size} << 56));
+    }
+
+    std::size_t Finish() const noexcept {
+        return static_cast<std::size_t>(Mix(state_));
+    }
+
+private:
+    std::uint64_t state_ = kMultiplier;
+};
+
+template <class U>
+bool EqualValue(const U &lhs, const U &rhs);
+
+template <class U>
+auto CompareValue(const U &lhs, const U &rhs);
+
+template <class U>
+void HashValue(Hasher &hasher, const U &value);
+
+template <class T, std::size_t I, bool UseRuns>
+bool EqualField(const T &lhs, const T &rhs) {
+    using F = Field<T, I>;
+    using R = Runs<T>;
+    if constexpr (kIgnored<T, I>) {
+        return true;
+    } else if constexpr (UseRuns && R::selected[I]) {
+        if constexpr (R::run_end[I] != 0) {
+            return std::memcmp(reinterpret_cast<const unsigned char *>(&lhs) + F::offset,
+                               reinterpret_cast<const unsigned char *>(&rhs) + F::offset, R::run_end[I] - F::offset) == 0;
+        } else {
+            return true;
+        }
+    } else {
+        return EqualValue(F::Get(lhs), F::Get(rhs));
+    }
+}
+
+template <class T, std::size_t I, bool UseRuns>
+void HashField(Hasher &hasher, const T &object) {
+    using F = Field<T, I>;
+    using R = Runs<T>;
+    if constexpr (kIgnored<T, I>) {
+    } else if constexpr (UseRuns && R::selected[I]) {
+        if constexpr (R::run_end[I] != 0) {
+            hasher.Bytes(reinterpret_cast<const unsigned char *>(&object) + F::offset, R::run_end[I] - F::offset);
+        }
+    } else {
+        HashValue(hasher, F::Get(object));
+    }
+}
+
+template <class T, std::size_t I, bool = kIgnored<T, I>>
+struct FieldOrdering {
+    using Type = std::strong_ordering;
+};
+
+template <class T, std::size_t I>
+struct FieldOrdering<T, I, false> {
+    using Type = decltype(CompareValue(std::declval<const typename Field<T, I>::Type &>(),
+                                       std::declval<const typename Field<T, I>::Type &>()));
+};
+
+// Stores the comparison of field I in result and returns whether the
+// fields are equivalent.
+template <class T, std::size_t I, class Category>
+bool CompareField(const T &lhs, const T &rhs, Category &result) {
+    if constexpr (kIgnored<T, I>) {
+        return true;
+    } else {
+        result = CompareValue(Field<T, I>::Get(lhs), Field<T, I>::Get(rhs));
+        return result == 0;
+    }
+}
+
+template <class T, std::size_t... Is>
+auto CompareFields(const T &lhs, const T &rhs, std::index_sequence<Is...>) {
+    std::common_comparison_category_t<typename FieldOrdering<T, Is>::Type...> result = std::strong_ordering::equal;
+    (void)(CompareField<T, Is>(lhs, rhs, result) && ...);
+    return result;
+}
+
+template <class U>
+bool EqualValue(const U &lhs, const U &rhs) {
+    if constexpr (Reflected<U>) {
+        if constexpr (Runs<U>::whole) {
+            return std::memcmp(&lhs, &rhs, sizeof(U)) == 0;
+        } else {
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                if (Runs<U>::Hold(lhs)) {
+                    return (EqualField<U, Is, true>(lhs, rhs) && ...);
+                }
+                return (EqualField<U, Is, false>(lhs, rhs) && ...);
+            }(std::make_index_sequence<Describe<U>::num_fields>{});
+        }
+    } else if constexpr (!HoldsReflected<U>()) {
+        return lhs == rhs;
+    } else if constexpr (kIsInstance<std::optional, U>) {
+        return lhs.has_value() == rhs.has_value() && (!lhs || EqualValue(*lhs, *rhs));
+    } else {
+        return std::ranges::equal(lhs, rhs, [](const auto &a, const auto &b) { return EqualValue(a, b); });
+    }
+}
+
+template <class U>
+auto CompareValue(const U &lhs, const U &rhs) {
+    if constexpr (Reflected<U>) {
+        return CompareFields(lhs, rhs, std::make_index_sequence<Describe<U>::num_fields>{});
+    } else if constexpr (!HoldsReflected<U>()) {
+        return std::compare_three_way{}(lhs, rhs);
+    } else if constexpr (kIsInstance<std::optional, U>) {
+        // An empty optional orders before every value, as with <=>.
+        using Category = decltype(CompareValue(*lhs, *rhs));
+        if (lhs && rhs) {
+            return CompareValue(*lhs, *rhs);
+        }
+        return Category(lhs.has_value() <=> rhs.has_value());
+    } else {
+        return std::lexicographical_compare_three_way(std::ranges::begin(lhs), std::ranges::end(lhs),
+                                                      std::ranges::begin(rhs), std::ranges::end(rhs),
+                                                      [](const auto &a, const auto &b) { return CompareValue(a, b); });
+    }
+}
+
+template <class U>
+void HashValue(Hasher &hasher, const U &value) {
+    if constexpr (Reflected<U>) {
+        if constexpr (Runs<U>::whole) {
+            hasher.Bytes(&value, sizeof(U));
+        } else {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                if (Runs<U>::Hold(value)) {
+                    (HashField<U, Is, true>(hasher, value), ...);
+                } else {
+                    (HashField<U, Is, false>(hasher, value), ...);
+                }
+            }(std::make_index_sequence<Describe<U>::num_fields>{});
+        }
+    } else if constexpr (std::has_unique_object_representations_v<U>) {
+        hasher.Bytes(&value, sizeof(U));
+    } else if constexpr (std::is_floating_point_v<U>) {
+        // -0.0 == 0.0, so both must hash alike.
+        const U normalized = value == U{0} ? U{0} : value;
+        hasher.Bytes(&normalized, sizeof(U));
+    } else if constexpr (BytewiseRange<U>) {
+        hasher.Word(std::ranges::size(value));
+        hasher.Bytes(std::ranges::data(value), std::ranges::size(value) * sizeof(std::ranges::range_value_t<U>));
+    } else if constexpr (std::ranges::sized_range<U>) {
+        hasher.Word(std::ranges::size(value));
+        for (const auto &element : value) {
+            HashValue(hasher, element);
+        }
+    } else if constexpr (kIsInstance<std::optional, U>) {
+        hasher.Word(value.has_value());
+        if (value) {
+            HashValue(hasher, *value);
+        }
+    } else {
+        hasher.Word(std::hash<U>{}(value));
+    }
+}
+
+} // namespace detail
+
+template <class T>
+bool Equal(const T &lhs, const T &rhs) {
+    return detail::EqualValue(lhs, rhs);
+}
+
+// Lexicographic over the fields; the result category is the common
+// category of the fields' comparisons.
+template <class T>
+auto ThreeWay(const T &lhs, const T &rhs) {
+    return detail::CompareValue(lhs, rhs);
+}
+
+template <class T>
+std::size_t Hash(const T &value) {
+    detail::Hasher hasher;
+    detail::HashValue(hasher, value);
+    return hasher.Finish();
+}
+
+// Function objects for hash tables and ordered containers.
+template <class T>
+struct Hasher {
+    std::size_t operator()(const T &value) const {
+        return compare::Hash(value);
+    }
+};
+
+template <class T>
+struct EqualTo {
+    bool operator()(const T &lhs, const T &rhs) const {
+        return compare::Equal(lhs, rhs);
+    }
+};
+
+template <class T>
+struct Less {
+    bool operator()(const T &lhs, const T &rhs) const {
+        return compare::ThreeWay(lhs, rhs) < 0;
+    }
+};
+
+} // namespace compare
@@ -0,0 +1,725 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <FixedString.hpp>
+#include <reflect.hpp>
+
+
+// JSON writer and streaming reader generated from Describe<T>.
+//
+// A field takes part in JSON only if it is annotated with its key:
+//
+//     struct Quote {
+//         Annotate<json::Name<"symbol"_cstr>> _symbol;
+//         std::string symbol;
+//         Annotate<json::Name<"bid"_cstr>> _bid;
+//         double bid;
+//         int cache;  // no name: neither written nor read
+//     };
+//
+// Supported values: bool, integers and enums (as numbers), floating point,
+// std::string, std::string_view, std::optional, std::vector, std::array and
+// nested aggregates. JSON has no NaN or infinity: they are written as null,
+// and null reads back into a floating-point field as NaN. FixedString.hpp lives in task2, so both task2 and task5
+// must be on the include path.
+//
+// The writer emits every key as a precomputed ",\"key\":" fragment of fixed
+// size. The reader parses straight into T: keys are looked up through a
+// perfect hash built at compile time, unknown keys have their values
+// skipped, and missing keys leave fields untouched. std::string_view fields
+// point into the input and cannot hold escaped strings. Input that is not
+// RFC 8259 JSON is rejected: numbers with leading zeros, raw control
+// characters in strings, unpaired surrogates in \u escapes, and arrays and
+// objects nested more than kMaxDepth deep, known keys or not.
+namespace json {
+
+inline constexpr std::size_t kMaxDepth = 512;
+
+template <FixedString<256> Key>
+struct Name {};
+
+class ParseError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+namespace detail {
+
+template <class Annotations>
+struct NameOf {
+    static constexpr bool found = false;
+    static constexpr std::string_view value = {};
+};
+
+template <FixedString<256> Key, class... As>
+struct NameOf<Annotate<Name<Key>, As...>> {
+    static constexpr bool found = true;
+    static constexpr std::string_view value = Key;
+};
+
+template <class A, class... As>
+struct NameOf<Annotate<A, As...>> : NameOf<Annotate<As...>> {};
+
+template <class T, std::size_t I>
+using FieldName = NameOf<typename reflect_detail::Field<T, I>::Annotations>;
+
+using reflect_detail::kDependentFalse;
+using reflect_detail::kIsInstance;
+using reflect_detail::kIsStdArray;
+
+constexpr bool PlainKey(std::string_view key) {
+    for (const char c : key) {
+        if (c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr std::uint64_t HashKey(std::string_view key, std::uint64_t seed) {
+    std::uint64_t h = 0xcbf29ce484222325ull ^ (seed * 0x9e3779b97f4a7c15ull);
+    for (const char c : key) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 0x100000001b3ull;
+    }
+    return h ^ (h >> 29);
+}
+
+// Named fields of T and a perfect hash from key to field index: a seed is
+// searched for that sends every key to its own slot, and the table grows
+// until one is found.
+template <class T>
+struct Keys {
+    static constexpr std::size_t num_fields = Describe<T>::num_fields;
+
+    template <std::size_t... Is>
+    static constexpr std::array<std::string_view, num_fields> Names(std::index_sequence<Is...>) {
+        return {FieldName<T, Is>::value...};
+    }
+
+    template <std::size_t... Is>
+    static constexpr std::array<bool, num_fields> Named(std::index_sequence<Is...>) {
+        return {FieldName<T, Is>::found...};
+    }
+
+    static constexpr std::array<std::string_view, num_fields> names = Names(std::make_index_sequence<num_fields>{});
+    static constexpr std::array<bool, num_fields> named = Named(std::make_index_sequence<num_fields>{});
+
+    static constexpr std::size_t kMaxSlots = 4096;
+
+    struct Table {
+        std::uint64_t seed = 0;
+        std::size_t mask = 0;
+    };
+
+    static constexpr bool Fits(std::uint64_t seed, std::size_t slots) {
+        std::array<std::uint64_t, kMaxSlots / 64> used{};
+        for (std::size_t i = 0; i < num_fields; ++i) {
+            if (named[i]) {
+                const std::size_t slot = HashKey(names[i], seed) & (slots - 1);
+                const std::uint64_t bit = std::uint64_t{1} << (slot % 64);
+                if ((used[slot / 64] & bit) != 0) {
+                    return false;
+                }
+                used[slot / 64] |= bit;
+            }
+        }
+        return true;
+    }
+
+    static constexpr Table table = [] {
+        for (std::size_t slots = std::bit_ceil(4 * num_fields + 1);; slots *= 2) {
+            if (slots > kMaxSlots) {
+                throw "json: cannot build a perfect hash for the keys";
+            }
+            for (std::uint64_t seed = 0; seed < 4096; ++seed) {
+                if (Fits(seed, slots)) {
+                    return Table{seed, slots - 1};
+                }
+            }
+        }
+    }();
+
+    // slots[h] is the index of the field whose key hashes to h, or
+    // num_fields.
+    static constexpr auto slots = [] {
+        std::array<std::size_t, table.mask + 1> result{};
+        result.fill(num_fields);
+        for (std::size_t i = 0; i < num_fields; ++i) {
+            if (named[i]) {
+                result[HashKey(names[i], table.seed) & table.mask] = i;
+            }
+        }
+        return result;
+    }();
+
+    static constexpr std::size_t Find(std::string_view key) noexcept {
+        const std::size_t i = slots[HashKey(key, table.seed) & table.mask];
+        return i < num_fields && names[i] == key ? i : num_fields;
+    }
+
+    static constexpr std::size_t FirstNamed() {
+        for (std::size_t i = 0; i < num_fields; ++i) {
+            if (named[i]) {
+                return i;
+            }
+        }
+        return num_fields;
+    }
+
+    // The ",\"key\":" fragment of field I, without the comma for the
+    // first named field.
+    template <std::size_t I>
+    static constexpr auto fragment = [] {
+        constexpr std::string_view key = names[I];
+        static_assert(PlainKey(key), "json: keys must not need escaping");
+        constexpr std::size_t comma = I == FirstNamed() ? 0 : 1;
+        std::array<char, comma + key.size() + 3> result{};
+        std::size_t pos = 0;
+        if (comma != 0) {
+            result[pos++] = ',';
+        }
+        result[pos++] = '"';
+        for (const char c : key) {
+            result[pos++] = c;
+        }
+        result[pos++] = '"';
+        result[pos++] = ':';
+        return result;
+    }();
+};
+
+inline void WriteString(std::string &out, std::string_view value) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    out.push_back('"');
+    std::size_t plain = 0;
+    for (std::size_t i = 0; i < value.size(); ++i) {
+        const auto c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        out.append(value.data() + plain, i - plain);
+        plain = i + 1;
+        switch (c) {
+        case '"':
+            out.append("\\\"");
+            break;
+        case '\\':
+            out.append("\\\\");
+            break;
+        case '\n':
+            out.append("\\n");
+            break;
+        case '\r':
+            out.append("\\r");
+            break;
+        case '\t':
+            out.append("\\t");
+            break;
+        default:
+            out.append("\\u00");
+            out.push_back(kHex[c >> 4]);
+            out.push_back(kHex[c & 0xf]);
+        }
+    }
+    out.append(value.data() + plain, value.size() - plain);
+    out.push_back('"');
+}
+
+template <class U>
+void WriteNumber(std::string &out, U value) {
+    char buffer[64];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+template <class T>
+void WriteObject(std::string &out, const T &object);
+
+template <class U>
+void WriteValue(std::string &out, const U &value) {
+    if constexpr (std::is_same_v<U, bool>) {
+        out.append(value ? "true" : "false");
+    } else if constexpr (std::is_enum_v<U>) {
+        WriteNumber(out, static_cast<std::underlying_type_t<U>>(value));
+    } else if constexpr (std::is_integral_v<U>) {
+        WriteNumber(out, value);
+    } else if constexpr (std::is_floating_point_v<U>) {
+        if (std::isfinite(value)) {
+            WriteNumber(out, value);
+        } else {
+            out.append("null");
+        }
+    } else if constexpr (std::is_same_v<U, std::string> || std::is_same_v<U, std::string_view>) {
+        WriteString(out, value);
+    } else if constexpr (kIsInstance<std::optional, U>) {
+        if (value) {
+            WriteValue(out, *value);
+        } else {
+            out.append("null");
+        }
+    } else if constexpr (kIsInstance<std::vector, U> || kIsStdArray<U>) {
+        out.push_back('[');
+        bool first = true;
+        for (const auto &element : value) {
+            if (!std::exchange(first, false)) {
+                out.push_back(',');
+            }
+            WriteValue(out, element);
+        }
+        out.push_back(']');
+    } else if constexpr (std::is_class_v<U> && std::is_aggregate_v<U>) {
+        WriteObject(out, value);
+    } else {
+        static_assert(kDependentFalse<U>, "json: unsupported type");
+    }
+}
+
+template <class T>
+void WriteObject(std::string &out, const T &object) {
+    using K = Keys<T>;
+    out.push_back('{');
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        ([&] {
+            if constexpr (K::named[Is]) {
+                constexpr const auto &fragment = K::template fragment<Is>;
+                out.append(fragment.data(), fragment.size());
+                WriteValue(out, reflect_detail::Field<T, Is>::Get(object));
+            }
+        }(), ...);
+    }(std::make_index_sequence<K::num_fields>{});
+    out.push_back('}');
+}
+
+class Parser {
+public:
+    explicit Parser(std::string_view in) noexcept : begin_(in.data()), pos_(in.data()), end_(in.data() + in.size()) {
+    }
+
+    template <class U>
+    void Value(U &value) {
+        SkipSpace();
+        if constexpr (std::is_same_v<U, bool>) {
+            if (Literal("true")) {
+                value = true;
+            } else if (Literal("false")) {
+                value = false;
+            } else {
+                Fail("expected a boolean");
+            }
+        } else if constexpr (std::is_enum_v<U>) {
+            std::underlying_type_t<U> underlying{};
+            Number(underlying);
+            value = static_cast<U>(underlying);
+        } else if constexpr (std::is_floating_point_v<U>) {
+            if (Literal("null")) {
+                value = std::numeric_limits<U>::quiet_NaN();
+            } else {
+                Number(value);
+            }
+        } else if constexpr (std::is_arithmetic_v<U>) {
+            Number(value);
+        } else if constexpr (std::is_same_v<U, std::string>) {
+            bool escaped = false;
+            const std::string_view raw = RawString(escaped);
+            if (escaped) {
+                value.clear();
+                Unescape(raw, value);
+            } else {
+                value.assign(raw);
+            }
+        } else if constexpr (std::is_same_v<U, std::string_view>) {
+            bool escaped = false;
+            value = RawString(escaped);
+            if (escaped) {
+                Fail("escaped string cannot be read into std::string_view");
+            }
+        } else if constexpr (kIsInstance<std::optional, U>) {
+            if (Literal("null")) {
+                value.reset();
+            } else {
+                Value(value.emplace());
+            }
+        } else if constexpr (kIsInstance<std::vector, U>) {
+            value.clear();
+            Array([&] { Value(value.emplace_back()); });
+        } else if constexpr (kIsStdArray<U>) {
+            std::size_t count = 0;
+            Array([&] {
+                if (count == value.size()) {
+                    Fail("too many array elements");
+                }
+                Value(value[count++]);
+            });
+            if (count != value.size()) {
+                Fail("too few array elements");
+            }
+        } else if constexpr (std::is_class_v<U> && std::is_aggregate_v<U>) {
+            Object(value);
+        } else {
+            static_assert(kDependentFalse<U>, "json: unsupported type");
+        }
+    }
+
+    void Finish() {
+        SkipSpace();
+        if (pos_ != end_) {
+            Fail("trailing characters");
+        }
+    }
+
+private:
+    [[noreturn]] void Fail(const char *what) const {
+        throw ParseError("json: " + std::string(what) + " at offset " + std::to_string(pos_ - begin_));
+    }
+
+    void SkipSpace() noexcept {
+        while (pos_ != end_ && (*pos_ == ' ' || *pos_ == '\n' || *pos_ == '\r' || *pos_ == '\t')) {
+            ++pos_;
+        }
+    }
+
+    char Peek() {
+        SkipSpace();
+        if (pos_ == end_) {
+            Fail("unexpected end of input");
+        }
+        return *pos_;
+    }
+
+    void Expect(char c) {
+        if (Peek() != c) {
+            Fail("unexpected character");
+        }
+        ++pos_;
+    }
+
+    bool Literal(std::string_view literal) noexcept {
+        if (static_cast<std::size_t>(end_ - pos_) >= literal.size() && std::string_view(pos_, literal.size()) == literal) {
+            pos_ += literal.size();
+            return true;
+        }
+        return false;
+    }
+
+    bool Digits() noexcept {
+        const char *begin = pos_;
+        while (pos_ != end_ && '0' <= *pos_ && *pos_ <= '9') {
+            ++pos_;
+        }
+        return pos_ != begin;
+    }
+
+    bool At(char c) noexcept {
+        return pos_ != end_ && *pos_ == c;
+    }
+
+    // Moves past -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)? and returns
+    // where it started.
+    const char *NumberText() {
+        const char *begin = pos_;
+        if (At('-')) {
+            ++pos_;
+        }
+        bool valid = true;
+        if (At('0')) {
+            ++pos_;
+            valid = !Digits();
+        } else {
+            valid = Digits();
+        }
+        if (valid && At('.')) {
+            ++pos_;
+            valid = Digits();
+        }
+        if (valid && (At('e') || At('E'))) {
+            ++pos_;
+            if (At('+') || At('-')) {
+                ++pos_;
+            }
+            valid = Digits();
+        }
+        if (!valid) {
+            pos_ = begin;
+            Fail("invalid number");
+        }
+        return begin;
+    }
+
+    template <class U>
+    void Number(U &value) {
+        const char *begin = NumberText();
+        const auto result = std::from_chars(begin, pos_, value);
+        if (result.ec != std::errc{} || result.ptr != pos_) {
+            pos_ = begin;
+            Fail("invalid number");
+        }
+    }
+
+    void Descend() {
+        if (++depth_ > kMaxDepth) {
+            Fail("arrays and objects nested too deep");
+        }
+    }
+
+    // Contents of a string literal without the quotes, escapes untouched.
+    std::string_view RawString(bool &escaped) {
+        Expect('"');
+        const char *begin = pos_;
+        escaped = false;
+        for (; pos_ != end_; ++pos_) {
+            if (*pos_ == '"') {
+                return {begin, static_cast<std::size_t>(pos_++ - begin)};
+            }
+            if (static_cast<unsigned char>(*pos_) < 0x20) {
+                Fail("control character in string");
+            }
+            if (*pos_ == '\\') {
+                escaped = true;
+                if (++pos_ == end_) {
+                    break;
+                }
+            }
+        }
+        Fail("unterminated string");
+    }
+
+    static void AppendUtf8(std::string &out, std::uint32_t code) {
+        if (code < 0x80) {
+            out.push_back(static_cast<char>(code));
+        } else if (code < 0x800) {
+            out.push_back(static_cast<char>(0xc0 | code >> 6));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3f)));
+        } else if (code < 0x10000) {
+            out.push_back(static_cast<char>(0xe0 | code >> 12));
+            out.push_back(static_cast<char>(0x80 | (code >> 6 & 0x3f)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3f)));
+        } else {
+            out.push_back(static_cast<char>(0xf0 | code >> 18));
+            out.push_back(static_cast<char>(0x80 | (code >> 12 & 0x3f)));
+            out.push_back(static_cast<char>(0x80 | (code >> 6 & 0x3f)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3f)));
+        }
+    }
+
+    std::uint32_t Hex4(std::string_view raw, std::size_t &i) const {
+        std::uint32_t code = 0;
+        if (raw.size() - i < 4 ||
+            std::from_chars(raw.data() + i, raw.data() + i + 4, code, 16).ptr != raw.data() + i + 4) {
+            Fail("invalid \\u escape");
+        }
+        i += 4;
+        return code;
+    }
+
+    void Unescape(std::string_view raw, std::string &out) const {
+        for (std::size_t i = 0; i < raw.size();) {
+            const char c = raw[i++];
+            if (c != '\\') {
+                out.push_back(c);
+                continue;
+            }
+            switch (raw[i++]) {
+            case '"':
+                out.push_back('"');
+                break;
+            case '\\':
+                out.push_back('\\');
+                break;
+            case '/':
+                out.push_back('/');
+                break;
+            case 'b':
+                out.push_back('\b');
+                break;
+            case 'f':
+                out.push_back('\f');
+                break;
+            case 'n':
+                out.push_back('\n');
+                break;
+            case 'r':
+                out.push_back('\r');
+                break;
+            case 't':
+                out.push_back('\t');
+                break;
+            case 'u': {
+                std::uint32_t code = Hex4(raw, i);
+                if (0xdc00 <= code && code < 0xe000) {
+                    Fail("unpaired surrogate");
+                }
+                if (0xd800 <= code && code < 0xdc00) {
+                    if (raw.substr(i, 2) != "\\u") {
+                        Fail("unpaired surrogate");
+                    }
+                    i += 2;
+                    const std::uint32_t low = Hex4(raw, i);
+                    if (low < 0xdc00 || 0xe000 <= low) {
+                        Fail("unpaired surrogate");
+                    }
+                    code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                }
+                AppendUtf8(out, code);
+                break;
+            }
+            default:
+                Fail("invalid escape");
+            }
+        }
+    }
+
+    // Calls element() for every element of an array.
+    template <class Element>
+    void Array(Element &&element) {
+        Expect('[');
+        Descend();
+        if (Peek() == ']') {
+            ++pos_;
+            --depth_;
+            return;
+        }
+        do {
+            element();
+        } while (Peek() == ',' && ++pos_);
+        Expect(']');
+        --depth_;
+    }
+
+    // Reads field I of object if it is the field with index field.
+    template <class T, std::size_t I>
+    bool Field(std::size_t field, T &object) {
+        if constexpr (Keys<T>::named[I]) {
+            if (field == I) {
+                Value(reflect_detail::Field<T, I>::Get(object));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <class T>
+    void Object(T &object) {
+        using K = Keys<T>;
+        Expect('{');
+        Descend();
+        if (Peek() == '}') {
+            ++pos_;
+            --depth_;
+            return;
+        }
+        do {
+            bool escaped = false;
+            const std::string_view raw = RawString(escaped);
+            std::size_t field = K::num_fields;
+            if (escaped) {
+                std::string key;
+                Unescape(raw, key);
+                field = K::Find(key);
+            } else {
+                field = K::Find(raw);
+            }
+            Expect(':');
+            const bool known = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                return (Field<T, Is>(field, object) || ...);
+            }(std::make_index_sequence<K::num_fields>{});
+            if (!known) {
+                SkipValue();
+            }
+        } while (Peek() == ',' && ++pos_);
+        Expect('}');
+        --depth_;
+    }
+
+    void SkipValue() {
+        switch (Peek()) {
+        case '"': {
+            bool escaped = false;
+            RawString(escaped);
+            break;
+        }
+        case '{':
+            ++pos_;
+            Descend();
+            if (Peek() == '}') {
+                ++pos_;
+                --depth_;
+                break;
+            }
+            do {
+                bool escaped = false;
+                RawString(escaped);
+                Expect(':');
+                SkipValue();
+            } while (Peek() == ',' && ++pos_);
+            Expect('}');
+            --depth_;
+            break;
+        case '[':
+            Array([&] { SkipValue(); });
+            break;
+        case 't':
+        case 'f':
+        case 'n':
+            if (!Literal("true") && !Literal("false") && !Literal("null")) {
+                Fail("invalid literal");
+            }
+            break;
+        default:
+            // Only the grammar: the value has no type to fit.
+            NumberText();
+        }
+    }
+
+    const char *begin_;
+    const char *pos_;
+    const char *end_;
+    std::size_t depth_ = 0;
+};
+
+} // namespace detail
+
+// Appends the JSON encoding of value to out.
+template <class T>
+void Write(const T &value, std::string &out) {
+    detail::WriteValue(out, value);
+}
+
+template <class T>
+std::string Write(const T &value) {
+    std::string out;
+    Write(value, out);
+    return out;
+}
+
+// Parses in into value. Throws ParseError on malformed input or values
+// that do not fit the field types.
+template <class T>
+void Read(std::string_view in, T &value) {
+    detail::Parser parser(in);
+    parser.Value(value);
+    parser.Finish();
+}
+
+template <class T>
+T Read(std::string_view in) {
+    T value{};
+    Read(in, value);
+    return value;
+}
+
+} // namespace json
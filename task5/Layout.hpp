@@ -0,0 +1,388 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <reflect.hpp>
+
+
+// Layout report and padding-free storage for reflected aggregates.
+//
+// layout::Report<T> tells at compile time how T is laid out and how many of
+// its bytes hold no field, so memory budgets can be enforced with
+//
+//     static_assert(layout::Report<Order>::wasted <= 8);
+//
+// layout::PackedStorage<T> keeps the fields of T ordered by decreasing
+// alignment, which leaves at most tail padding, and squeezes fields
+// annotated with layout::Bits<N> into N bits each. Fields keep their
+// original indices: get<I>() and set<I>() address field I of T.
+namespace layout {
+
+// Stores an integral, enum or bool field in N bits inside PackedStorage.
+// N may not exceed the width of the field type. Values must fit; excess
+// bits are dropped.
+template <std::size_t N>
+    requires(N > 0 && N <= 64)
+struct Bits {};
+
+namespace detail {
+
+using reflect_detail::AlignUp;
+using reflect_detail::Field;
+
+template <class Annotations>
+struct BitsOf {
+    static constexpr std::size_t value = 0;
+};
+
+template <std::size_t N, class... As>
+struct BitsOf<Annotate<Bits<N>, As...>> {
+    static constexpr std::size_t value = N;
+};
+
+template <class A, class... As>
+struct BitsOf<Annotate<A, As...>> : BitsOf<Annotate<As...>> {};
+
+template <class U>
+concept BitPackable = std::is_integral_v<U> || std::is_enum_v<U>;
+
+template <class U>
+inline constexpr std::size_t kBitWidth = std::is_same_v<U, bool> ? 1 : sizeof(U) * CHAR_BIT;
+
+// Placement of every field of T inside PackedStorage<T>.
+template <class T>
+struct Plan {
+    static constexpr std::size_t num_fields = Describe<T>::num_fields;
+
+    template <std::size_t... Is>
+    static constexpr std::array<std::size_t, num_fields> Sizes(std::index_sequence<Is...>) {
+        return {sizeof(typename Field<T, Is>::Type)...};
+    }
+
+    template <std::size_t... Is>
+    static constexpr std::array<std::size_t, num_fields> Alignments(std::index_sequence<Is...>) {
+        return {alignof(typename Field<T, Is>::Type)...};
+    }
+
+    template <std::size_t... Is>
+    static constexpr std::array<std::size_t, num_fields> Widths(std::index_sequence<Is...>) {
+        return {BitsOf<typename Field<T, Is>::Annotations>::value...};
+    }
+
+    template <std::size_t... Is>
+    static constexpr bool WidthsFit(std::index_sequence<Is...>) {
+        return (true && ... && (BitsOf<typename Field<T, Is>::Annotations>::value <=
+                                kBitWidth<typename Field<T, Is>::Type>));
+    }
+
+    static_assert(WidthsFit(std::make_index_sequence<num_fields>{}), "layout::Bits<N> is wider than its field");
+
+    static constexpr std::array<std::size_t, num_fields> sizes = Sizes(std::make_index_sequence<num_fields>{});
+    static constexpr std::array<std::size_t, num_fields> alignments = Alignments(std::make_index_sequence<num_fields>{});
+
+    // Width in bits of a bit-packed field, 0 for the others.
+    static constexpr std::array<std::size_t, num_fields> widths = Widths(std::make_index_sequence<num_fields>{});
+
+    static constexpr std::size_t alignment = [] {
+        std::size_t result = 1;
+        for (std::size_t i = 0; i < num_fields; ++i) {
+            if (widths[i] == 0 && alignments[i] > result) {
+                result = alignments[i];
+            }
+        }
+        return result;
+    }();
+
+    // Byte fields sorted by decreasing alignment: as alignments are powers
+    // of two and sizes multiples of them, every field lands aligned.
+    static constexpr std::array<std::size_t, num_fields> offsets = [] {
+        std::array<std::size_t, num_fields> result{};
+        std::size_t offset = 0;
+        for (std::size_t align = alignment; align > 0; align /= 2) {
+            for (std::size_t i = 0; i < num_fields; ++i) {
+                if (widths[i] == 0 && alignments[i] == align) {
+                    result[i] = offset;
+                    offset += sizes[i];
+                }
+            }
+        }
+        return result;
+    }();
+
+    static constexpr std::size_t byte_size = [] {
+        std::size_t size = 0;
+        for (std::size_t i = 0; i < num_fields; ++i) {
+            size += widths[i] == 0 ? sizes[i] : 0;
+        }
+        return size;
+    }();
+
+    // First bit of a bit-packed field in the bit area after the byte fields.
+    static constexpr std::array<std::size_t, num_fields> bit_offsets = [] {
+        std::array<std::size_t, num_fields> result{};
+        std::size_t bit = 0;
+        for (std::size_t i = 0; i < num_fields; ++i) {
+            result[i] = bit;
+            bit += widths[i];
+        }
+        return result;
+    }();
+
+    static constexpr std::size_t bit_bytes = (bit_offsets.empty() ? 0 : bit_offsets.back() + widths.back() + 7) / 8;
+
+    static constexpr std::size_t size = AlignUp(byte_size + bit_bytes, alignment);
+};
+
+} // namespace detail
+
+template <class T>
+struct Report {
+    static_assert(Describe<T>::has_offsets, "layout::Report needs the field offsets of T");
+
+    using Plan = detail::Plan<T>;
+
+    static constexpr std::size_t num_fields = Plan::num_fields;
+    static constexpr std::size_t size = sizeof(T);
+    static constexpr std::size_t alignment = alignof(T);
+
+    // Bytes that hold field values.
+    static constexpr std::size_t used = [] {
+        std::size_t result = 0;
+        for (const std::size_t field_size : Plan::sizes) {
+            result += field_size;
+        }
+        return result;
+    }();
+
+    // Bytes of T that hold no field: padding and annotation members.
+    static constexpr std::size_t wasted = size - used;
+
+    // Wasted bytes right before field I and after the last field.
+    static constexpr std::array<std::size_t, num_fields> padding_before = [] {
+        std::array<std::size_t, num_fields> result{};
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            std::size_t end = 0;
+            ((result[Is] = detail::Field<T, Is>::offset - end, end = detail::Field<T, Is>::offset + Plan::sizes[Is]), ...);
+        }(std::make_index_sequence<num_fields>{});
+        return result;
+    }();
+
+    static constexpr std::size_t tail_padding = [] {
+        std::size_t padding = size;
+        for (const std::size_t before : padding_before) {
+            padding -= before;
+        }
+        return padding - used;
+    }();
+
+    static constexpr std::size_t packed_size = Plan::size;
+};
+
+template <class T>
+    requires std::is_aggregate_v<T>
+class PackedStorage {
+    using Plan = detail::Plan<T>;
+
+    template <std::size_t I>
+    using Type = typename detail::Field<T, I>::Type;
+
+    static constexpr std::size_t kNumFields = Plan::num_fields;
+
+public:
+    // Value-initializes every field.
+    PackedStorage() {
+        ConstructFields([]<std::size_t I>() { return Type<I>{}; });
+    }
+
+    explicit PackedStorage(const T &object) {
+        ConstructFields([&]<std::size_t I>() -> const Type<I> & { return detail::Field<T, I>::Get(object); });
+    }
+
+    PackedStorage(const PackedStorage &other) {
+        ConstructFields([&]<std::size_t I>() -> decltype(auto) { return other.get<I>(); });
+    }
+
+    PackedStorage(PackedStorage &&other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        ConstructFields([&]<std::size_t I>() -> decltype(auto) {
+            if constexpr (Plan::widths[I] == 0) {
+                return std::move(other.get<I>());
+            } else {
+                return other.get<I>();
+            }
+        });
+    }
+
+    PackedStorage &operator=(const PackedStorage &other) {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            (set<Is>(other.get<Is>()), ...);
+        }(std::make_index_sequence<kNumFields>{});
+        return *this;
+    }
+
+    PackedStorage &operator=(PackedStorage &&other) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            (set<Is>(std::move(other.get<Is>())), ...);
+        }(std::make_index_sequence<kNumFields>{});
+        return *this;
+    }
+
+    ~PackedStorage() {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            ((Plan::widths[Is] == 0 ? std::destroy_at(&ByteField<Is>()) : void()), ...);
+        }(std::make_index_sequence<kNumFields>{});
+    }
+
+    // Reference to field I, or its value if the field is bit-packed.
+    template <std::size_t I>
+    decltype(auto) get() noexcept {
+        if constexpr (Plan::widths[I] == 0) {
+            return ByteField<I>();
+        } else {
+            return BitField<I>();
+        }
+    }
+
+    template <std::size_t I>
+    decltype(auto) get() const noexcept {
+        if constexpr (Plan::widths[I] == 0) {
+            return static_cast<const Type<I> &>(const_cast<PackedStorage *>(this)->ByteField<I>());
+        } else {
+            return BitField<I>();
+        }
+    }
+
+    template <std::size_t I, class V>
+    void set(V &&value) {
+        if constexpr (Plan::widths[I] == 0) {
+            ByteField<I>() = std::forward<V>(value);
+        } else {
+            SetBitField<I>(static_cast<Type<I>>(value));
+        }
+    }
+
+    T unpack() const {
+        T object{};
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            ((detail::Field<T, Is>::Get(object) = get<Is>()), ...);
+        }(std::make_index_sequence<kNumFields>{});
+        return object;
+    }
+
+private:
+    template <std::size_t I>
+    Type<I> &ByteField() noexcept {
+        return *std::launder(reinterpret_cast<Type<I> *>(data_ + Plan::offsets[I]));
+    }
+
+    // Native-endian storage is read and written with one memcpy; the bit
+    // area is little-endian either way.
+    static std::uint64_t LoadWord(const std::byte *bytes, std::size_t size) noexcept {
+        std::uint64_t word = 0;
+        if constexpr (std::endian::native == std::endian::little) {
+            std::memcpy(&word, bytes, size);
+        } else {
+            for (std::size_t i = 0; i < size; ++i) {
+                word |= std::uint64_t{std::to_integer<unsigned>(bytes[i])} << (8 * i);
+            }
+        }
+        return word;
+    }
+
+    static void StoreWord(std::byte *bytes, std::size_t size, std::uint64_t word) noexcept {
+        if constexpr (std::endian::native == std::endian::little) {
+            std::memcpy(bytes, &word, size);
+        } else {
+            for (std::size_t i = 0; i < size; ++i) {
+                bytes[i] = static_cast<std::byte>(word >> (8 * i));
+            }
+        }
+    }
+
+    // Bit-packed field I lives in the bytes [first, first + span) of data_,
+    // starting shift bits into the first one. A 64-bit field that does not
+    // start on a byte boundary spans a ninth byte, handled on its own.
+    template <std::size_t I>
+    struct BitSpan {
+        static constexpr std::size_t width = Plan::widths[I];
+        static constexpr std::size_t first = Plan::byte_size + Plan::bit_offsets[I] / 8;
+        static constexpr std::size_t shift = Plan::bit_offsets[I] % 8;
+        static constexpr std::size_t span = (shift + width + 7) / 8;
+        static constexpr std::size_t word_bytes = std::min<std::size_t>(span, 8);
+        static constexpr std::uint64_t mask = width == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << width) - 1;
+    };
+
+    template <std::size_t I>
+    Type<I> BitField() const noexcept {
+        static_assert(detail::BitPackable<Type<I>>, "layout::Bits applies to integral and enum fields");
+        using S = BitSpan<I>;
+        std::uint64_t bits = LoadWord(data_ + S::first, S::word_bytes) >> S::shift;
+        if constexpr (S::span > 8) {
+            bits |= std::uint64_t{std::to_integer<unsigned>(data_[S::first + 8])} << (64 - S::shift);
+        }
+        bits &= S::mask;
+        using Plain = typename std::conditional_t<std::is_enum_v<Type<I>>, std::underlying_type<Type<I>>,
+                                                  std::type_identity<Type<I>>>::type;
+        if constexpr (std::is_signed_v<Plain> && Plan::widths[I] < 64) {
+            // Sign-extend from the top stored bit.
+            const std::uint64_t sign = std::uint64_t{1} << (Plan::widths[I] - 1);
+            bits = (bits ^ sign) - sign;
+        }
+        return static_cast<Type<I>>(static_cast<Plain>(bits));
+    }
+
+    template <std::size_t I>
+    void SetBitField(Type<I> value) noexcept {
+        static_assert(detail::BitPackable<Type<I>>, "layout::Bits applies to integral and enum fields");
+        using Plain = typename std::conditional_t<std::is_enum_v<Type<I>>, std::underlying_type<Type<I>>,
+                                                  std::type_identity<Type<I>>>::type;
+        using S = BitSpan<I>;
+        const std::uint64_t bits = static_cast<std::uint64_t>(static_cast<Plain>(value)) & S::mask;
+        const std::uint64_t word = LoadWord(data_ + S::first, S::word_bytes);
+        StoreWord(data_ + S::first, S::word_bytes, (word & ~(S::mask << S::shift)) | bits << S::shift);
+        if constexpr (S::span > 8) {
+            const auto high = static_cast<std::byte>(S::mask >> (64 - S::shift));
+            std::byte &byte = data_[S::first + 8];
+            byte = (byte & ~high) | static_cast<std::byte>(bits >> (64 - S::shift));
+        }
+    }
+
+    // Constructs field I from value.template operator()<I>(); on failure
+    // the fields constructed so far are destroyed.
+    template <class Value>
+    void ConstructFields(Value &&value) {
+        std::size_t constructed = 0;
+        try {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                ((Construct<Is>(value.template operator()<Is>()), ++constructed), ...);
+            }(std::make_index_sequence<kNumFields>{});
+        } catch (...) {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                ((Plan::widths[Is] == 0 && Is < constructed ? std::destroy_at(&ByteField<Is>()) : void()), ...);
+            }(std::make_index_sequence<kNumFields>{});
+            throw;
+        }
+    }
+
+    template <std::size_t I, class V>
+    void Construct(V &&value) {
+        if constexpr (Plan::widths[I] == 0) {
+            std::construct_at(reinterpret_cast<Type<I> *>(data_ + Plan::offsets[I]), std::forward<V>(value));
+        } else {
+            SetBitField<I>(static_cast<Type<I>>(value));
+        }
+    }
+
+    alignas(Plan::alignment) std::byte data_[Plan::size > 0 ? Plan::size : 1]{};
+};
+
+} // namespace layout
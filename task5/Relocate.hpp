@@ -0,0 +1,296 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <reflect.hpp>
+
+
+// Trivial relocatability: moving an object to a new address and destroying
+// the original is equivalent to copying its bytes. Most types are, the
+// exceptions hold pointers into themselves (libstdc++'s std::string with its
+// small-string buffer, intrusive list nodes and the like).
+//
+// relocate::kTrivial<U> is true for
+//   - types that declare `using trivially_relocatable = std::true_type;`
+//     (`std::false_type` opts a type out);
+//   - trivially copyable types;
+//   - std::unique_ptr, std::shared_ptr, std::weak_ptr, std::vector with the
+//     default allocator, and std::optional / std::array of relocatable types;
+//   - aggregates whose fields all are. A field annotated with
+//     relocate::Trivially or relocate::Never overrides the deduction.
+//
+// A trivially copyable type that still must not be moved bytewise (say it
+// stores its own address) has to opt out with the member typedef: its fields
+// are never inspected.
+namespace relocate {
+
+struct Trivially {};
+struct Never {};
+
+template <class U>
+constexpr bool IsTrivial();
+
+template <class U>
+inline constexpr bool kTrivial = IsTrivial<std::remove_cv_t<U>>();
+
+namespace detail {
+
+template <class U>
+concept Declared = requires { typename U::trivially_relocatable; };
+
+// Library types whose relocatability is known without looking inside.
+template <class U>
+struct Known {
+    static constexpr bool known = false;
+};
+
+template <bool Value>
+struct KnownAs {
+    static constexpr bool known = true;
+    static constexpr bool value = Value;
+};
+
+template <class E>
+struct Known<std::unique_ptr<E>> : KnownAs<true> {};
+
+template <class E>
+struct Known<std::shared_ptr<E>> : KnownAs<true> {};
+
+template <class E>
+struct Known<std::weak_ptr<E>> : KnownAs<true> {};
+
+template <class E>
+struct Known<std::vector<E>> : KnownAs<true> {};
+
+template <class E>
+struct Known<std::optional<E>> : KnownAs<kTrivial<E>> {};
+
+template <class E, std::size_t N>
+struct Known<std::array<E, N>> : KnownAs<kTrivial<E>> {};
+
+template <class T, std::size_t I>
+constexpr bool FieldTrivial() {
+    using F = reflect_detail::Field<T, I>;
+    if constexpr (F::template has_annotation_class<Never>) {
+        return false;
+    } else if constexpr (F::template has_annotation_class<Trivially>) {
+        return true;
+    } else {
+        return kTrivial<typename F::Type>;
+    }
+}
+
+template <class T, std::size_t... Is>
+constexpr bool AllFieldsTrivial(std::index_sequence<Is...>) {
+    return (true && ... && FieldTrivial<T, Is>());
+}
+
+} // namespace detail
+
+template <class U>
+constexpr bool IsTrivial() {
+    if constexpr (detail::Declared<U>) {
+        return U::trivially_relocatable::value;
+    } else if constexpr (std::is_trivially_copyable_v<U>) {
+        return true;
+    } else if constexpr (detail::Known<U>::known) {
+        return detail::Known<U>::value;
+    } else if constexpr (std::is_class_v<U> && std::is_aggregate_v<U>) {
+        return detail::AllFieldsTrivial<U>(std::make_index_sequence<Describe<U>::num_fields>{});
+    } else {
+        return false;
+    }
+}
+
+// Moves [first, first + count) into uninitialized memory at dest and ends
+// the lifetime of the source objects. The ranges must not overlap. As with
+// std::move_if_noexcept, a copyable T whose move may throw is copied
+// instead, so that if a copy throws the source range is left as it was.
+template <class T>
+T *Relocate(T *first, std::size_t count, T *dest) noexcept(kTrivial<T> || std::is_nothrow_move_constructible_v<T>) {
+    if constexpr (kTrivial<T>) {
+        if (count != 0) {
+            std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first), count * sizeof(T));
+        }
+        return dest + count;
+    } else if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+        T *end = std::uninitialized_move_n(first, count, dest).second;
+        std::destroy_n(first, count);
+        return end;
+    } else {
+        T *end = std::uninitialized_copy_n(first, count, dest);
+        std::destroy_n(first, count);
+        return end;
+    }
+}
+
+template <class T>
+T *RelocateAt(T *source, T *dest) noexcept(kTrivial<T> || std::is_nothrow_move_constructible_v<T>) {
+    return Relocate(source, 1, dest);
+}
+
+} // namespace relocate
+
+// A vector whose reallocation relocates its elements. For trivially
+// relocatable T that is a single std::realloc, which often grows the block
+// in place; other types are moved and destroyed one by one.
+template <class T>
+class RelocatingVector {
+    // std::realloc only guarantees fundamental alignment.
+    static constexpr bool kRealloc = relocate::kTrivial<T> && alignof(T) <= alignof(std::max_align_t);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    RelocatingVector() = default;
+
+    // Delegates so that the destructor frees the buffer if a copy throws.
+    RelocatingVector(const RelocatingVector &other) : RelocatingVector() {
+        reserve(other.size_);
+        std::uninitialized_copy_n(other.data_, other.size_, data_);
+        size_ = other.size_;
+    }
+
+    RelocatingVector(RelocatingVector &&other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          capacity_(std::exchange(other.capacity_, 0)) {
+    }
+
+    RelocatingVector &operator=(RelocatingVector other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        return *this;
+    }
+
+    ~RelocatingVector() {
+        clear();
+        Free(data_);
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    T *data() noexcept {
+        return data_;
+    }
+
+    const T *data() const noexcept {
+        return data_;
+    }
+
+    T &operator[](std::size_t i) noexcept {
+        return data_[i];
+    }
+
+    const T &operator[](std::size_t i) const noexcept {
+        return data_[i];
+    }
+
+    T *begin() noexcept {
+        return data_;
+    }
+
+    T *end() noexcept {
+        return data_ + size_;
+    }
+
+    const T *begin() const noexcept {
+        return data_;
+    }
+
+    const T *end() const noexcept {
+        return data_ + size_;
+    }
+
+    void reserve(std::size_t capacity) {
+        if (capacity > capacity_) {
+            Reallocate(capacity);
+        }
+    }
+
+    void clear() noexcept {
+        std::destroy_n(data_, size_);
+        size_ = 0;
+    }
+
+    void push_back(const T &value) {
+        emplace_back(value);
+    }
+
+    void push_back(T &&value) {
+        emplace_back(std::move(value));
+    }
+
+    template <class... Args>
+    T &emplace_back(Args &&...args) {
+        if (size_ == capacity_) {
+            // args may refer to an element, so build the new one first.
+            T value(std::forward<Args>(args)...);
+            Reallocate(std::max<std::size_t>(2 * capacity_, 8));
+            return *std::construct_at(data_ + size_++, std::move_if_noexcept(value));
+        }
+        return *std::construct_at(data_ + size_++, std::forward<Args>(args)...);
+    }
+
+    void pop_back() noexcept {
+        std::destroy_at(data_ + --size_);
+    }
+
+private:
+    static void Free(T *data) noexcept {
+        if constexpr (kRealloc) {
+            std::free(data);
+        } else {
+            ::operator delete(data, std::align_val_t{alignof(T)});
+        }
+    }
+
+    void Reallocate(std::size_t capacity) {
+        if constexpr (kRealloc) {
+            void *data = std::realloc(static_cast<void *>(data_), capacity * sizeof(T));
+            if (data == nullptr) {
+                throw std::bad_alloc();
+            }
+            data_ = static_cast<T *>(data);
+        } else {
+            T *data = static_cast<T *>(::operator new(capacity * sizeof(T), std::align_val_t{alignof(T)}));
+            try {
+                relocate::Relocate(data_, size_, data);
+            } catch (...) {
+                ::operator delete(data, std::align_val_t{alignof(T)});
+                throw;
+            }
+            Free(data_);
+            data_ = data;
+        }
+        capacity_ = capacity;
+    }
+
+    T *data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
+};
@@ -0,0 +1,504 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <reflect.hpp>
+
+
+// Binary serialization generated from Describe<T>.
+//
+// Wire format of a value of type U:
+//   - bool: one byte, 0 or 1; any other byte is a DecodeError;
+//   - other trivially copyable U: its object representation (native
+//     endianness);
+//   - std::string, std::string_view, std::span<const B> with a one-byte B:
+//     LEB128 length followed by the bytes;
+//   - std::vector<E>: LEB128 length followed by the elements;
+//   - any other aggregate: its fields in declaration order.
+// A trivially copyable aggregate with padding or annotation bytes is written
+// field by field instead, so that no indeterminate byte reaches the wire.
+// Runs of plain trivially copyable fields that touch in memory are copied
+// with one memcpy.
+//
+// Enums are not range-checked: every value of an enum with a fixed underlying
+// type is valid, but an enum without one must only be read from trusted input.
+//
+// Per-field encodings are selected with annotations:
+//
+//     struct Order {
+//         Annotate<serialize::Varint> _id;
+//         std::uint64_t id;
+//         Annotate<serialize::BigEndian> _price;
+//         std::int32_t price;
+//         Annotate<serialize::Skip> _cache;
+//         double cache;
+//     };
+//
+// Skipped fields are neither written nor touched by reading.
+//
+// Zero-copy reads: std::string_view and std::span<const B> fields are
+// deserialized as views into the input buffer, which must outlive them.
+namespace serialize {
+
+struct Skip {};
+
+// LEB128, zigzag-encoded for signed types. Integral and enum fields only.
+// Decoding throws DecodeError for a value that does not fit the field type
+// and for encodings longer than needed.
+struct Varint {};
+
+// Fixed-width integral or enum in the given byte order.
+struct LittleEndian {};
+struct BigEndian {};
+
+class DecodeError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+namespace detail {
+
+template <class U>
+inline constexpr bool kIsView = false;
+
+template <>
+inline constexpr bool kIsView<std::string_view> = true;
+
+template <class B>
+inline constexpr bool kIsView<std::span<const B>> = sizeof(B) == 1 && std::is_trivially_copyable_v<B>;
+
+using reflect_detail::Field;
+using reflect_detail::kDependentFalse;
+using reflect_detail::kIsInstance;
+using reflect_detail::kIsStdArray;
+
+// Bytes of U that hold its value; x87 long double pads 10 bytes to 16.
+template <class U>
+inline constexpr std::size_t kValueSize = sizeof(U);
+
+template <>
+inline constexpr std::size_t kValueSize<long double> =
+    std::numeric_limits<long double>::digits == 64 ? 10 : sizeof(long double);
+
+template <class T, std::size_t I>
+inline constexpr bool kHasEncoding =
+    Field<T, I>::template has_annotation_class<Skip> || Field<T, I>::template has_annotation_class<Varint> ||
+    Field<T, I>::template has_annotation_class<LittleEndian> || Field<T, I>::template has_annotation_class<BigEndian>;
+
+template <class U>
+constexpr bool IsRaw();
+
+template <class T, std::size_t... Is>
+constexpr bool AllFieldsRaw(std::index_sequence<Is...>) {
+    return (true && ... && (!kHasEncoding<T, Is> && IsRaw<typename Field<T, Is>::Type>()));
+}
+
+// Whether U is written as its object representation (possibly field by
+// field). bool is not: an arbitrary byte is not a valid bool, so it is
+// decoded and checked on its own.
+template <class U>
+constexpr bool IsRaw() {
+    if constexpr (!std::is_trivially_copyable_v<U> || std::is_pointer_v<U> || std::is_member_pointer_v<U> ||
+                  kIsView<U> || std::is_same_v<U, bool>) {
+        return false;
+    } else if constexpr (kIsStdArray<U>) {
+        return IsRaw<typename U::value_type>();
+    } else if constexpr (std::is_class_v<U> && std::is_aggregate_v<U>) {
+        return AllFieldsRaw<U>(std::make_index_sequence<Describe<U>::num_fields>{});
+    } else {
+        return true;
+    }
+}
+
+template <class U>
+constexpr bool IsBlock();
+
+// Field I of T is a plain raw field without padding; runs of those that
+// touch in memory are copied at once.
+template <class T, std::size_t I>
+struct BlockField : std::bool_constant<!kHasEncoding<T, I> && IsBlock<typename Field<T, I>::Type>()> {};
+
+template <class T>
+using Runs = reflect_detail::Runs<T, BlockField>;
+
+// Whether U is written with one memcpy of sizeof(U) bytes: raw and free of
+// padding, so every byte written is part of a value.
+template <class U>
+constexpr bool IsBlock() {
+    if constexpr (!IsRaw<U>()) {
+        return false;
+    } else if constexpr (kIsStdArray<U>) {
+        return IsBlock<typename U::value_type>();
+    } else if constexpr (std::is_class_v<U> && std::is_aggregate_v<U>) {
+        return Runs<U>::whole;
+    } else {
+        return kValueSize<U> == sizeof(U);
+    }
+}
+
+// Counts the encoded size, so that Writer can allocate once.
+class Sizer {
+public:
+    void Bytes(const void *, std::size_t size) noexcept {
+        size_ += size;
+    }
+
+    void Byte(std::uint8_t) noexcept {
+        ++size_;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+private:
+    std::size_t size_ = 0;
+};
+
+class Writer {
+public:
+    explicit Writer(std::byte *out) noexcept : pos_(out) {
+    }
+
+    void Bytes(const void *data, std::size_t size) noexcept {
+        std::memcpy(pos_, data, size);
+        pos_ += size;
+    }
+
+    void Byte(std::uint8_t byte) noexcept {
+        *pos_++ = static_cast<std::byte>(byte);
+    }
+
+private:
+    std::byte *pos_;
+};
+
+class Reader {
+public:
+    explicit Reader(std::span<const std::byte> in) noexcept : begin_(in.data()), pos_(in.data()), end_(in.data() + in.size()) {
+    }
+
+    const std::byte *Take(std::size_t size) {
+        if (static_cast<std::size_t>(end_ - pos_) < size) {
+            throw DecodeError("serialize: unexpected end of input");
+        }
+        return std::exchange(pos_, pos_ + size);
+    }
+
+    void Bytes(void *data, std::size_t size) {
+        std::memcpy(data, Take(size), size);
+    }
+
+    std::uint8_t Byte() {
+        return static_cast<std::uint8_t>(*Take(1));
+    }
+
+    std::size_t remaining() const noexcept {
+        return static_cast<std::size_t>(end_ - pos_);
+    }
+
+    std::size_t consumed() const noexcept {
+        return static_cast<std::size_t>(pos_ - begin_);
+    }
+
+private:
+    const std::byte *begin_;
+    const std::byte *pos_;
+    const std::byte *end_;
+};
+
+template <class U>
+using Plain = typename std::conditional_t<std::is_enum_v<U>, std::underlying_type<U>, std::type_identity<U>>::type;
+
+template <class U>
+using Bits = std::make_unsigned_t<Plain<U>>;
+
+template <class U>
+concept Integer = (std::is_integral_v<U> && !std::is_same_v<U, bool>) || std::is_enum_v<U>;
+
+template <class Sink>
+void PutVarint(Sink &sink, std::uint64_t value) {
+    while (value >= 0x80) {
+        sink.Byte(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    sink.Byte(static_cast<std::uint8_t>(value));
+}
+
+// Accepts only what PutVarint writes: no bits past the 64th, and no final
+// zero byte after the first.
+inline std::uint64_t GetVarint(Reader &reader) {
+    std::uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        const std::uint8_t byte = reader.Byte();
+        if (shift == 63 && byte > 1) {
+            throw DecodeError("serialize: varint overflows 64 bits");
+        }
+        value |= std::uint64_t{byte & 0x7fu} << shift;
+        if ((byte & 0x80) == 0) {
+            if (byte == 0 && shift != 0) {
+                throw DecodeError("serialize: overlong varint");
+            }
+            return value;
+        }
+    }
+    throw DecodeError("serialize: varint is too long");
+}
+
+inline std::size_t GetLength(Reader &reader, std::size_t element_size) {
+    const std::uint64_t length = GetVarint(reader);
+    if (length > reader.remaining() / element_size) {
+        throw DecodeError("serialize: length exceeds input");
+    }
+    return static_cast<std::size_t>(length);
+}
+
+template <Integer U>
+std::uint64_t ZigZag(U value) {
+    const auto bits = static_cast<Bits<U>>(value);
+    if constexpr (std::is_signed_v<Plain<U>>) {
+        const auto wide = static_cast<std::int64_t>(static_cast<std::make_signed_t<Bits<U>>>(bits));
+        return (static_cast<std::uint64_t>(wide) << 1) ^ static_cast<std::uint64_t>(wide >> 63);
+    } else {
+        return bits;
+    }
+}
+
+// Throws DecodeError if the value does not fit U.
+template <Integer U>
+U UnZigZag(std::uint64_t encoded) {
+    using Signed = std::make_signed_t<Bits<U>>;
+    if constexpr (std::is_signed_v<Plain<U>>) {
+        const std::int64_t wide = static_cast<std::int64_t>(encoded >> 1) ^ -static_cast<std::int64_t>(encoded & 1);
+        if (!std::in_range<Signed>(wide)) {
+            throw DecodeError("serialize: integer out of range");
+        }
+        return static_cast<U>(static_cast<Signed>(wide));
+    } else {
+        if (!std::in_range<Bits<U>>(encoded)) {
+            throw DecodeError("serialize: integer out of range");
+        }
+        return static_cast<U>(static_cast<Bits<U>>(encoded));
+    }
+}
+
+template <class Order, Integer U, class Sink>
+void PutFixed(Sink &sink, U value) {
+    const auto bits = static_cast<Bits<U>>(value);
+    std::array<std::uint8_t, sizeof(U)> bytes{};
+    for (std::size_t i = 0; i < sizeof(U); ++i) {
+        const std::size_t at = std::is_same_v<Order, LittleEndian> ? i : sizeof(U) - 1 - i;
+        bytes[at] = static_cast<std::uint8_t>(static_cast<std::uint64_t>(bits) >> (8 * i));
+    }
+    sink.Bytes(bytes.data(), bytes.size());
+}
+
+template <class Order, Integer U>
+U GetFixed(Reader &reader) {
+    const std::byte *bytes = reader.Take(sizeof(U));
+    std::uint64_t bits = 0;
+    for (std::size_t i = 0; i < sizeof(U); ++i) {
+        const std::size_t at = std::is_same_v<Order, LittleEndian> ? i : sizeof(U) - 1 - i;
+        bits |= std::uint64_t{static_cast<std::uint8_t>(bytes[at])} << (8 * i);
+    }
+    return static_cast<U>(static_cast<Bits<U>>(bits));
+}
+
+template <class T, class Sink>
+void EncodeFields(const T &object, Sink &sink);
+
+template <class T>
+void DecodeFields(Reader &reader, T &object);
+
+template <class U, class Sink>
+void Encode(const U &value, Sink &sink) {
+    if constexpr (IsBlock<U>()) {
+        sink.Bytes(&value, sizeof(U));
+    } else if constexpr (std::is_floating_point_v<U>) {
+        sink.Bytes(&value, kValueSize<U>);
+    } else if constexpr (std::is_same_v<U, bool>) {
+        sink.Byte(value ? 1 : 0);
+    } else if constexpr (std::is_same_v<U, std::string> || kIsView<U>) {
+        PutVarint(sink, value.size());
+        sink.Bytes(value.data(), value.size());
+    } else if constexpr (kIsInstance<std::vector, U>) {
+        PutVarint(sink, value.size());
+        if constexpr (IsBlock<typename U::value_type>()) {
+            sink.Bytes(value.data(), value.size() * sizeof(typename U::value_type));
+        } else {
+            for (const auto &element : value) {
+                Encode(element, sink);
+            }
+        }
+    } else if constexpr (kIsStdArray<U>) {
+        for (const auto &element : value) {
+            Encode(element, sink);
+        }
+    } else if constexpr (std::is_class_v<U> && std::is_aggregate_v<U>) {
+        EncodeFields(value, sink);
+    } else {
+        static_assert(kDependentFalse<U>, "serialize: unsupported type");
+    }
+}
+
+template <class U>
+void Decode(Reader &reader, U &value) {
+    if constexpr (IsBlock<U>()) {
+        reader.Bytes(&value, sizeof(U));
+    } else if constexpr (std::is_floating_point_v<U>) {
+        value = U{};
+        reader.Bytes(&value, kValueSize<U>);
+    } else if constexpr (std::is_same_v<U, bool>) {
+        const std::uint8_t byte = reader.Byte();
+        if (byte > 1) {
+            throw DecodeError("serialize: invalid bool");
+        }
+        value = byte != 0;
+    } else if constexpr (std::is_same_v<U, std::string>) {
+        const std::size_t length = GetLength(reader, 1);
+        value.assign(reinterpret_cast<const char *>(reader.Take(length)), length);
+    } else if constexpr (kIsView<U>) {
+        const std::size_t length = GetLength(reader, 1);
+        value = U(reinterpret_cast<const typename U::value_type *>(reader.Take(length)), length);
+    } else if constexpr (kIsInstance<std::vector, U>) {
+        using Element = typename U::value_type;
+        const std::size_t length = GetLength(reader, IsBlock<Element>() ? sizeof(Element) : 1);
+        value.resize(length);
+        if constexpr (IsBlock<Element>()) {
+            reader.Bytes(value.data(), length * sizeof(Element));
+        } else {
+            for (auto &element : value) {
+                Decode(reader, element);
+            }
+        }
+    } else if constexpr (kIsStdArray<U>) {
+        for (auto &element : value) {
+            Decode(reader, element);
+        }
+    } else if constexpr (std::is_class_v<U> && std::is_aggregate_v<U>) {
+        DecodeFields(reader, value);
+    } else {
+        static_assert(kDependentFalse<U>, "serialize: unsupported type");
+    }
+}
+
+template <class T, std::size_t I, bool UseRuns, class Sink>
+void EncodeField(const T &object, Sink &sink) {
+    using F = Field<T, I>;
+    using R = Runs<T>;
+    if constexpr (F::template has_annotation_class<Skip>) {
+    } else if constexpr (F::template has_annotation_class<Varint>) {
+        PutVarint(sink, ZigZag(F::Get(object)));
+    } else if constexpr (F::template has_annotation_class<LittleEndian>) {
+        PutFixed<LittleEndian>(sink, F::Get(object));
+    } else if constexpr (F::template has_annotation_class<BigEndian>) {
+        PutFixed<BigEndian>(sink, F::Get(object));
+    } else if constexpr (UseRuns && R::selected[I]) {
+        if constexpr (R::run_end[I] != 0) {
+            sink.Bytes(reinterpret_cast<const unsigned char *>(&object) + F::offset, R::run_end[I] - F::offset);
+        }
+    } else {
+        Encode(F::Get(object), sink);
+    }
+}
+
+template <class T, std::size_t I, bool UseRuns>
+void DecodeField(Reader &reader, T &object) {
+    using F = Field<T, I>;
+    using R = Runs<T>;
+    using Type = typename F::Type;
+    if constexpr (F::template has_annotation_class<Skip>) {
+    } else if constexpr (F::template has_annotation_class<Varint>) {
+        F::Get(object) = UnZigZag<Type>(GetVarint(reader));
+    } else if constexpr (F::template has_annotation_class<LittleEndian>) {
+        F::Get(object) = GetFixed<LittleEndian, Type>(reader);
+    } else if constexpr (F::template has_annotation_class<BigEndian>) {
+        F::Get(object) = GetFixed<BigEndian, Type>(reader);
+    } else if constexpr (UseRuns && R::selected[I]) {
+        if constexpr (R::run_end[I] != 0) {
+            reader.Bytes(reinterpret_cast<unsigned char *>(&object) + F::offset, R::run_end[I] - F::offset);
+        }
+    } else {
+        Decode(reader, F::Get(object));
+    }
+}
+
+template <class T, class Sink>
+void EncodeFields(const T &object, Sink &sink) {
+    const bool use_runs = Runs<T>::Hold(object);
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        if (use_runs) {
+            (EncodeField<T, Is, true>(object, sink), ...);
+        } else {
+            (EncodeField<T, Is, false>(object, sink), ...);
+        }
+    }(std::make_index_sequence<Describe<T>::num_fields>{});
+}
+
+template <class T>
+void DecodeFields(Reader &reader, T &object) {
+    const bool use_runs = Runs<T>::Hold(object);
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        if (use_runs) {
+            (DecodeField<T, Is, true>(reader, object), ...);
+        } else {
+            (DecodeField<T, Is, false>(reader, object), ...);
+        }
+    }(std::make_index_sequence<Describe<T>::num_fields>{});
+}
+
+} // namespace detail
+
+// Size of the encoding of value in bytes.
+template <class T>
+std::size_t EncodedSize(const T &value) {
+    detail::Sizer sizer;
+    detail::Encode(value, sizer);
+    return sizer.size();
+}
+
+// Appends the encoding of value to out.
+template <class T>
+void Serialize(const T &value, std::vector<std::byte> &out) {
+    const std::size_t offset = out.size();
+    out.resize(offset + EncodedSize(value));
+    detail::Writer writer(out.data() + offset);
+    detail::Encode(value, writer);
+}
+
+template <class T>
+std::vector<std::byte> Serialize(const T &value) {
+    std::vector<std::byte> out;
+    Serialize(value, out);
+    return out;
+}
+
+// Reads value from the front of in and returns the number of bytes read.
+// Throws DecodeError on truncated or malformed input.
+template <class T>
+std::size_t Deserialize(std::span<const std::byte> in, T &value) {
+    detail::Reader reader(in);
+    detail::Decode(reader, value);
+    return reader.consumed();
+}
+
+template <class T>
+T Deserialize(std::span<const std::byte> in) {
+    T value{};
+    Deserialize(in, value);
+    return value;
+}
+
+} // namespace serialize
@@ -0,0 +1,403 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <reflect.hpp>
+
+
+namespace soa {
+
+// Puts the column of the annotated field into the cold block, a second
+// allocation that scans over the hot columns never touch.
+struct Cold {};
+
+namespace detail {
+
+// Every column starts on its own cache line.
+inline constexpr std::size_t kColumnAlignment = 64;
+
+using reflect_detail::AlignUp;
+using reflect_detail::Field;
+
+template <class T, std::size_t I>
+using Column = typename Field<T, I>::Type;
+
+template <class T, std::size_t... Is>
+constexpr std::array<bool, sizeof...(Is)> ColdFields(std::index_sequence<Is...>) {
+    return {Field<T, Is>::template has_annotation_class<Cold>...};
+}
+
+// Columns of one block placed back to back in a single allocation.
+template <class T>
+struct Block {
+    static constexpr std::size_t num_fields = Describe<T>::num_fields;
+    static constexpr std::array<bool, num_fields> cold = ColdFields<T>(std::make_index_sequence<num_fields>{});
+
+    template <std::size_t... Is>
+    static constexpr std::array<std::size_t, num_fields> Sizes(std::index_sequence<Is...>) {
+        return {sizeof(Column<T, Is>)...};
+    }
+
+    static constexpr std::array<std::size_t, num_fields> sizes = Sizes(std::make_index_sequence<num_fields>{});
+
+    // Byte offset of a column in its block for the given capacity.
+    static constexpr std::size_t Offset(std::size_t column, std::size_t capacity) {
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < column; ++i) {
+            if (cold[i] == cold[column]) {
+                offset += AlignUp(sizes[i] * capacity, kColumnAlignment);
+            }
+        }
+        return offset;
+    }
+
+    static constexpr std::size_t BlockSize(bool is_cold, std::size_t capacity) {
+        std::size_t size = 0;
+        for (std::size_t i = 0; i < num_fields; ++i) {
+            if (cold[i] == is_cold) {
+                size += AlignUp(sizes[i] * capacity, kColumnAlignment);
+            }
+        }
+        return size;
+    }
+};
+
+} // namespace detail
+} // namespace soa
+
+// A vector of T that keeps every field of T in its own contiguous array.
+// All hot columns live in one allocation and all cold columns (fields
+// annotated with soa::Cold) in another, so growth costs at most two
+// allocations. T must be a default-constructible aggregate described by
+// Describe<T>.
+template <class T>
+    requires std::is_aggregate_v<T> && std::is_default_constructible_v<T>
+class SoAVector {
+    using Block = soa::detail::Block<T>;
+
+    template <std::size_t I>
+    using Column = soa::detail::Column<T, I>;
+
+    static constexpr std::size_t kNumFields = Describe<T>::num_fields;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    // Proxy for row i: get<I>() is the field, conversion gathers the whole
+    // row into a T and assignment scatters one.
+    template <bool Const>
+    class Reference {
+    public:
+        using Vector = std::conditional_t<Const, const SoAVector, SoAVector>;
+
+        Reference(Vector *vector, std::size_t i) noexcept : vector_(vector), i_(i) {
+        }
+
+        template <std::size_t I>
+        auto &get() const noexcept {
+            return vector_->template column<I>()[i_];
+        }
+
+        operator T() const {
+            T row{};
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                ((soa::detail::Field<T, Is>::Get(row) = get<Is>()), ...);
+            }(std::make_index_sequence<kNumFields>{});
+            return row;
+        }
+
+        const Reference &operator=(const T &row) const
+            requires(!Const)
+        {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                ((get<Is>() = soa::detail::Field<T, Is>::Get(row)), ...);
+            }(std::make_index_sequence<kNumFields>{});
+            return *this;
+        }
+
+    private:
+        Vector *vector_;
+        std::size_t i_;
+    };
+
+    template <bool Const>
+    class Iterator {
+    public:
+        using Vector = std::conditional_t<Const, const SoAVector, SoAVector>;
+        using value_type = T;
+        using reference = Reference<Const>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+
+        Iterator() = default;
+
+        Iterator(Vector *vector, std::size_t i) noexcept : vector_(vector), i_(i) {
+        }
+
+        reference operator*() const noexcept {
+            return {vector_, i_};
+        }
+
+        Iterator &operator++() noexcept {
+            ++i_;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator copy = *this;
+            ++i_;
+            return copy;
+        }
+
+        bool operator==(const Iterator &other) const noexcept {
+            return i_ == other.i_;
+        }
+
+    private:
+        Vector *vector_ = nullptr;
+        std::size_t i_ = 0;
+    };
+
+    using reference = Reference<false>;
+    using const_reference = Reference<true>;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    SoAVector() = default;
+
+    // Delegates so that the destructor destroys the rows built so far and
+    // frees both blocks if a copy throws.
+    SoAVector(const SoAVector &other) : SoAVector() {
+        reserve(other.size_);
+        for (std::size_t i = 0; i < other.size_; ++i) {
+            EmplaceRow([&]<std::size_t I>() -> const Column<I> & { return other.column<I>()[i]; });
+        }
+    }
+
+    SoAVector(SoAVector &&other) noexcept
+        : hot_(std::exchange(other.hot_, nullptr)),
+          cold_(std::exchange(other.cold_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          capacity_(std::exchange(other.capacity_, 0)) {
+    }
+
+    SoAVector &operator=(SoAVector other) noexcept {
+        std::swap(hot_, other.hot_);
+        std::swap(cold_, other.cold_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        return *this;
+    }
+
+    ~SoAVector() {
+        clear();
+        Deallocate(hot_, cold_);
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    void reserve(std::size_t capacity) {
+        if (capacity > capacity_) {
+            Reallocate(capacity);
+        }
+    }
+
+    void clear() noexcept {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            (std::destroy_n(ColumnData<Is>(), size_), ...);
+        }(std::make_index_sequence<kNumFields>{});
+        size_ = 0;
+    }
+
+    void pop_back() noexcept {
+        --size_;
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            (std::destroy_at(ColumnData<Is>() + size_), ...);
+        }(std::make_index_sequence<kNumFields>{});
+    }
+
+    void push_back(const T &row) {
+        EmplaceRow([&]<std::size_t I>() -> const Column<I> & { return soa::detail::Field<T, I>::Get(row); });
+    }
+
+    void push_back(T &&row) {
+        EmplaceRow([&]<std::size_t I>() -> Column<I> && { return std::move(soa::detail::Field<T, I>::Get(row)); });
+    }
+
+    // Constructs the new row field by field, one argument per field.
+    template <class... Args>
+        requires(sizeof...(Args) == kNumFields)
+    void emplace_back(Args &&...args) {
+        auto forwarded = std::forward_as_tuple(std::forward<Args>(args)...);
+        EmplaceRow([&]<std::size_t I>() -> decltype(auto) { return std::get<I>(std::move(forwarded)); });
+    }
+
+    reference operator[](std::size_t i) noexcept {
+        return {this, i};
+    }
+
+    const_reference operator[](std::size_t i) const noexcept {
+        return {this, i};
+    }
+
+    // Contiguous column of field I, aligned to a cache line.
+    template <std::size_t I>
+    std::span<Column<I>> column() noexcept {
+        return {ColumnData<I>(), size_};
+    }
+
+    template <std::size_t I>
+    std::span<const Column<I>> column() const noexcept {
+        return {ColumnData<I>(), size_};
+    }
+
+    iterator begin() noexcept {
+        return {this, 0};
+    }
+
+    iterator end() noexcept {
+        return {this, size_};
+    }
+
+    const_iterator begin() const noexcept {
+        return {this, 0};
+    }
+
+    const_iterator end() const noexcept {
+        return {this, size_};
+    }
+
+private:
+    template <std::size_t I>
+    static Column<I> *ColumnData(std::byte *hot, std::byte *cold, std::size_t capacity) noexcept {
+        std::byte *block = Block::cold[I] ? cold : hot;
+        return reinterpret_cast<Column<I> *>(block + Block::Offset(I, capacity));
+    }
+
+    template <std::size_t I>
+    Column<I> *ColumnData() const noexcept {
+        return ColumnData<I>(hot_, cold_, capacity_);
+    }
+
+    static std::byte *Allocate(bool is_cold, std::size_t capacity) {
+        const std::size_t size = Block::BlockSize(is_cold, capacity);
+        if (size == 0) {
+            return nullptr;
+        }
+        return static_cast<std::byte *>(::operator new(size, std::align_val_t{soa::detail::kColumnAlignment}));
+    }
+
+    static void Deallocate(std::byte *hot, std::byte *cold) noexcept {
+        ::operator delete(hot, std::align_val_t{soa::detail::kColumnAlignment});
+        ::operator delete(cold, std::align_val_t{soa::detail::kColumnAlignment});
+    }
+
+    template <std::size_t I>
+    static constexpr bool kNothrowMove = std::is_nothrow_move_constructible_v<Column<I>>;
+
+    // Moves column I into the given blocks, or copies it if its move may
+    // throw, as std::move_if_noexcept does.
+    template <std::size_t I>
+    void TransferColumn(std::byte *hot, std::byte *cold, std::size_t capacity) {
+        if constexpr (kNothrowMove<I> || !std::is_copy_constructible_v<Column<I>>) {
+            std::uninitialized_move_n(ColumnData<I>(), size_, ColumnData<I>(hot, cold, capacity));
+        } else {
+            std::uninitialized_copy_n(ColumnData<I>(), size_, ColumnData<I>(hot, cold, capacity));
+        }
+    }
+
+    // Moves the rows into new blocks of the given capacity. Given a row,
+    // also builds row size_ there, before anything is moved, since its
+    // arguments may refer to the old rows. Columns that may throw are copied
+    // before any other column is moved, so if anything throws the new
+    // blocks are released and the old rows are untouched.
+    template <class... Row>
+    void Reallocate(std::size_t capacity, Row &&...row) {
+        std::byte *hot = Allocate(false, capacity);
+        std::byte *cold = nullptr;
+        bool built = false;
+        std::array<bool, kNumFields> copied{};
+        try {
+            cold = Allocate(true, capacity);
+            if constexpr (sizeof...(Row) != 0) {
+                ConstructRow(hot, cold, capacity, row...);
+                built = true;
+            }
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                ((kNothrowMove<Is> ? void() : (TransferColumn<Is>(hot, cold, capacity), void(copied[Is] = true))), ...);
+            }(std::make_index_sequence<kNumFields>{});
+        } catch (...) {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                ((copied[Is] ? void(std::destroy_n(ColumnData<Is>(hot, cold, capacity), size_)) : void()), ...);
+                ((built ? std::destroy_at(ColumnData<Is>(hot, cold, capacity) + size_) : void()), ...);
+            }(std::make_index_sequence<kNumFields>{});
+            Deallocate(hot, cold);
+            throw;
+        }
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            ((kNothrowMove<Is> ? TransferColumn<Is>(hot, cold, capacity) : void()), ...);
+            (std::destroy_n(ColumnData<Is>(), size_), ...);
+        }(std::make_index_sequence<kNumFields>{});
+        Deallocate(hot_, cold_);
+        hot_ = hot;
+        cold_ = cold;
+        capacity_ = capacity;
+    }
+
+    // Constructs row size_ of the given blocks with column I initialized
+    // from value.template operator()<I>(). Undoes the partial row if a
+    // column throws.
+    template <class Value>
+    void ConstructRow(std::byte *hot, std::byte *cold, std::size_t capacity, Value &value) {
+        std::size_t constructed = 0;
+        try {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                ((std::construct_at(ColumnData<Is>(hot, cold, capacity) + size_, value.template operator()<Is>()),
+                  ++constructed),
+                 ...);
+            }(std::make_index_sequence<kNumFields>{});
+        } catch (...) {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                ((Is < constructed ? std::destroy_at(ColumnData<Is>(hot, cold, capacity) + size_) : void()), ...);
+            }(std::make_index_sequence<kNumFields>{});
+            throw;
+        }
+    }
+
+    // Appends a row with column I initialized from
+    // value.template operator()<I>().
+    template <class Value>
+    void EmplaceRow(Value &&value) {
+        if (size_ == capacity_) {
+            Reallocate(std::max<std::size_t>(2 * capacity_, 8), value);
+        } else {
+            ConstructRow(hot_, cold_, capacity_, value);
+        }
+        ++size_;
+    }
+
+    std::byte *hot_ = nullptr;
+    std::byte *cold_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
+};
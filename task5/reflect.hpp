@@ -1,29 +1,828 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 
 template <class...>
 class Annotate {};
 
-struct /* unspecified (field descriptor) */ {
-    using Type = /* ... */;
-    using Annotations = Annotate</* ... */>;
+namespace reflect_detail {
+
+// Placeholder convertible to any field type: T can be aggregate-initialized
+// from N of them iff T has at least N fields. The lvalue conversion only
+// serves reference members; for the others the rvalue one is the better
+// match.
+struct AnyField {
+    template <class U>
+    operator U() const && noexcept;
+
+    template <class U>
+    operator U &() const & noexcept;
+};
+
+template <class T, std::size_t... Is>
+constexpr bool Constructible(std::index_sequence<Is...>) {
+    return requires { T{(void(Is), AnyField{})...}; };
+}
+
+inline constexpr std::size_t kMaxRawFields = 64;
+
+// Number of data members, annotations included. C arrays are not supported
+// as fields: brace elision makes them indistinguishable from several fields.
+template <class T, std::size_t N = 0>
+constexpr std::size_t CountRawFields() {
+    static_assert(N <= kMaxRawFields, "Describe supports at most 64 members, annotations included");
+    if constexpr (Constructible<T>(std::make_index_sequence<N + 1>{})) {
+        return CountRawFields<T, N + 1>();
+    } else {
+        return N;
+    }
+}
+
+template <std::size_t N>
+using Count = std::integral_constant<std::size_t, N>;
+
+// Data members of an object read off a structured binding of the right
+// size. Fields are their declared types (reference members stay
+// references); pointers point at them, except for bit-fields, which have no
+// address and get nullptr.
+template <class Fields, class Pointers>
+struct Bound {
+    Pointers pointers;
+};
+
+template <class Fields, class... Ps>
+constexpr Bound<Fields, std::tuple<Ps...>> MakeBound(Ps... pointers) noexcept {
+    return {std::tuple<Ps...>(pointers...)};
+}
+
+template <bool BitField>
+    requires(!BitField)
+constexpr auto Address(auto &field) noexcept {
+    return std::addressof(field);
+}
+
+template <bool BitField>
+    requires(BitField)
+constexpr std::nullptr_t Address(const auto &) noexcept {
+    return nullptr;
+}
+
+template <class T>
+constexpr Bound<std::tuple<>, std::tuple<>> Bind(T &, Count<0>) noexcept {
+    return {};
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<1>) noexcept {
+    auto &[f0] = object;
+    constexpr std::array<bool, 1> bit_fields = {!requires { &f0; }};
+    return MakeBound<std::tuple<decltype(f0)>>(Address<bit_fields[0]>(f0));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<2>) noexcept {
+    auto &[f0, f1] = object;
+    constexpr std::array<bool, 2> bit_fields = {!requires { &f0; }, !requires { &f1; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<3>) noexcept {
+    auto &[f0, f1, f2] = object;
+    constexpr std::array<bool, 3> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<4>) noexcept {
+    auto &[f0, f1, f2, f3] = object;
+    constexpr std::array<bool, 4> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<5>) noexcept {
+    auto &[f0, f1, f2, f3, f4] = object;
+    constexpr std::array<bool, 5> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<6>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5] = object;
+    constexpr std::array<bool, 6> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<7>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6] = object;
+    constexpr std::array<bool, 7> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<8>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7] = object;
+    constexpr std::array<bool, 8> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<9>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8] = object;
+    constexpr std::array<bool, 9> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<10>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = object;
+    constexpr std::array<bool, 10> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<11>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = object;
+    constexpr std::array<bool, 11> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<12>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = object;
+    constexpr std::array<bool, 12> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<13>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = object;
+    constexpr std::array<bool, 13> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<14>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = object;
+    constexpr std::array<bool, 14> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<15>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = object;
+    constexpr std::array<bool, 15> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<16>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = object;
+    constexpr std::array<bool, 16> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<17>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16] = object;
+    constexpr std::array<bool, 17> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<18>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17] = object;
+    constexpr std::array<bool, 18> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<19>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18] = object;
+    constexpr std::array<bool, 19> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<20>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19] = object;
+    constexpr std::array<bool, 20> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<21>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20] = object;
+    constexpr std::array<bool, 21> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<22>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21] = object;
+    constexpr std::array<bool, 22> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<23>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22] = object;
+    constexpr std::array<bool, 23> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<24>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23] = object;
+    constexpr std::array<bool, 24> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<25>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24] = object;
+    constexpr std::array<bool, 25> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<26>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25] = object;
+    constexpr std::array<bool, 26> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<27>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26] = object;
+    constexpr std::array<bool, 27> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<28>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27] = object;
+    constexpr std::array<bool, 28> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<29>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28] = object;
+    constexpr std::array<bool, 29> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<30>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29] = object;
+    constexpr std::array<bool, 30> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<31>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30] = object;
+    constexpr std::array<bool, 31> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<32>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31] = object;
+    constexpr std::array<bool, 32> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<33>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32] = object;
+    constexpr std::array<bool, 33> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<34>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33] = object;
+    constexpr std::array<bool, 34> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<35>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34] = object;
+    constexpr std::array<bool, 35> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<36>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35] = object;
+    constexpr std::array<bool, 36> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<37>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36] = object;
+    constexpr std::array<bool, 37> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<38>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37] = object;
+    constexpr std::array<bool, 38> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<39>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38] = object;
+    constexpr std::array<bool, 39> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<40>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39] = object;
+    constexpr std::array<bool, 40> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<41>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40] = object;
+    constexpr std::array<bool, 41> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<42>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41] = object;
+    constexpr std::array<bool, 42> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<43>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42] = object;
+    constexpr std::array<bool, 43> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<44>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43] = object;
+    constexpr std::array<bool, 44> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<45>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44] = object;
+    constexpr std::array<bool, 45> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<46>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45] = object;
+    constexpr std::array<bool, 46> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<47>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46] = object;
+    constexpr std::array<bool, 47> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<48>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47] = object;
+    constexpr std::array<bool, 48> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<49>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48] = object;
+    constexpr std::array<bool, 49> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<50>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49] = object;
+    constexpr std::array<bool, 50> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<51>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50] = object;
+    constexpr std::array<bool, 51> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<52>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51] = object;
+    constexpr std::array<bool, 52> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<53>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52] = object;
+    constexpr std::array<bool, 53> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }, !requires { &f52; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51), Address<bit_fields[52]>(f52));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<54>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53] = object;
+    constexpr std::array<bool, 54> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }, !requires { &f52; }, !requires { &f53; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51), Address<bit_fields[52]>(f52), Address<bit_fields[53]>(f53));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<55>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54] = object;
+    constexpr std::array<bool, 55> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }, !requires { &f52; }, !requires { &f53; }, !requires { &f54; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53), decltype(f54)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51), Address<bit_fields[52]>(f52), Address<bit_fields[53]>(f53), Address<bit_fields[54]>(f54));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<56>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55] = object;
+    constexpr std::array<bool, 56> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }, !requires { &f52; }, !requires { &f53; }, !requires { &f54; }, !requires { &f55; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53), decltype(f54), decltype(f55)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51), Address<bit_fields[52]>(f52), Address<bit_fields[53]>(f53), Address<bit_fields[54]>(f54), Address<bit_fields[55]>(f55));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<57>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56] = object;
+    constexpr std::array<bool, 57> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }, !requires { &f52; }, !requires { &f53; }, !requires { &f54; }, !requires { &f55; }, !requires { &f56; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53), decltype(f54), decltype(f55), decltype(f56)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51), Address<bit_fields[52]>(f52), Address<bit_fields[53]>(f53), Address<bit_fields[54]>(f54), Address<bit_fields[55]>(f55), Address<bit_fields[56]>(f56));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<58>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57] = object;
+    constexpr std::array<bool, 58> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }, !requires { &f52; }, !requires { &f53; }, !requires { &f54; }, !requires { &f55; }, !requires { &f56; }, !requires { &f57; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53), decltype(f54), decltype(f55), decltype(f56), decltype(f57)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51), Address<bit_fields[52]>(f52), Address<bit_fields[53]>(f53), Address<bit_fields[54]>(f54), Address<bit_fields[55]>(f55), Address<bit_fields[56]>(f56), Address<bit_fields[57]>(f57));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<59>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58] = object;
+    constexpr std::array<bool, 59> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }, !requires { &f52; }, !requires { &f53; }, !requires { &f54; }, !requires { &f55; }, !requires { &f56; }, !requires { &f57; }, !requires { &f58; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53), decltype(f54), decltype(f55), decltype(f56), decltype(f57), decltype(f58)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51), Address<bit_fields[52]>(f52), Address<bit_fields[53]>(f53), Address<bit_fields[54]>(f54), Address<bit_fields[55]>(f55), Address<bit_fields[56]>(f56), Address<bit_fields[57]>(f57), Address<bit_fields[58]>(f58));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<60>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59] = object;
+    constexpr std::array<bool, 60> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }, !requires { &f52; }, !requires { &f53; }, !requires { &f54; }, !requires { &f55; }, !requires { &f56; }, !requires { &f57; }, !requires { &f58; }, !requires { &f59; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53), decltype(f54), decltype(f55), decltype(f56), decltype(f57), decltype(f58), decltype(f59)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51), Address<bit_fields[52]>(f52), Address<bit_fields[53]>(f53), Address<bit_fields[54]>(f54), Address<bit_fields[55]>(f55), Address<bit_fields[56]>(f56), Address<bit_fields[57]>(f57), Address<bit_fields[58]>(f58), Address<bit_fields[59]>(f59));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<61>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60] = object;
+    constexpr std::array<bool, 61> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }, !requires { &f52; }, !requires { &f53; }, !requires { &f54; }, !requires { &f55; }, !requires { &f56; }, !requires { &f57; }, !requires { &f58; }, !requires { &f59; }, !requires { &f60; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53), decltype(f54), decltype(f55), decltype(f56), decltype(f57), decltype(f58), decltype(f59), decltype(f60)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51), Address<bit_fields[52]>(f52), Address<bit_fields[53]>(f53), Address<bit_fields[54]>(f54), Address<bit_fields[55]>(f55), Address<bit_fields[56]>(f56), Address<bit_fields[57]>(f57), Address<bit_fields[58]>(f58), Address<bit_fields[59]>(f59), Address<bit_fields[60]>(f60));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<62>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61] = object;
+    constexpr std::array<bool, 62> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }, !requires { &f52; }, !requires { &f53; }, !requires { &f54; }, !requires { &f55; }, !requires { &f56; }, !requires { &f57; }, !requires { &f58; }, !requires { &f59; }, !requires { &f60; }, !requires { &f61; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53), decltype(f54), decltype(f55), decltype(f56), decltype(f57), decltype(f58), decltype(f59), decltype(f60), decltype(f61)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51), Address<bit_fields[52]>(f52), Address<bit_fields[53]>(f53), Address<bit_fields[54]>(f54), Address<bit_fields[55]>(f55), Address<bit_fields[56]>(f56), Address<bit_fields[57]>(f57), Address<bit_fields[58]>(f58), Address<bit_fields[59]>(f59), Address<bit_fields[60]>(f60), Address<bit_fields[61]>(f61));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<63>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61, f62] = object;
+    constexpr std::array<bool, 63> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }, !requires { &f52; }, !requires { &f53; }, !requires { &f54; }, !requires { &f55; }, !requires { &f56; }, !requires { &f57; }, !requires { &f58; }, !requires { &f59; }, !requires { &f60; }, !requires { &f61; }, !requires { &f62; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53), decltype(f54), decltype(f55), decltype(f56), decltype(f57), decltype(f58), decltype(f59), decltype(f60), decltype(f61), decltype(f62)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51), Address<bit_fields[52]>(f52), Address<bit_fields[53]>(f53), Address<bit_fields[54]>(f54), Address<bit_fields[55]>(f55), Address<bit_fields[56]>(f56), Address<bit_fields[57]>(f57), Address<bit_fields[58]>(f58), Address<bit_fields[59]>(f59), Address<bit_fields[60]>(f60), Address<bit_fields[61]>(f61), Address<bit_fields[62]>(f62));
+}
+
+template <class T>
+constexpr auto Bind(T &object, Count<64>) noexcept {
+    auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61, f62, f63] = object;
+    constexpr std::array<bool, 64> bit_fields = {!requires { &f0; }, !requires { &f1; }, !requires { &f2; }, !requires { &f3; }, !requires { &f4; }, !requires { &f5; }, !requires { &f6; }, !requires { &f7; }, !requires { &f8; }, !requires { &f9; }, !requires { &f10; }, !requires { &f11; }, !requires { &f12; }, !requires { &f13; }, !requires { &f14; }, !requires { &f15; }, !requires { &f16; }, !requires { &f17; }, !requires { &f18; }, !requires { &f19; }, !requires { &f20; }, !requires { &f21; }, !requires { &f22; }, !requires { &f23; }, !requires { &f24; }, !requires { &f25; }, !requires { &f26; }, !requires { &f27; }, !requires { &f28; }, !requires { &f29; }, !requires { &f30; }, !requires { &f31; }, !requires { &f32; }, !requires { &f33; }, !requires { &f34; }, !requires { &f35; }, !requires { &f36; }, !requires { &f37; }, !requires { &f38; }, !requires { &f39; }, !requires { &f40; }, !requires { &f41; }, !requires { &f42; }, !requires { &f43; }, !requires { &f44; }, !requires { &f45; }, !requires { &f46; }, !requires { &f47; }, !requires { &f48; }, !requires { &f49; }, !requires { &f50; }, !requires { &f51; }, !requires { &f52; }, !requires { &f53; }, !requires { &f54; }, !requires { &f55; }, !requires { &f56; }, !requires { &f57; }, !requires { &f58; }, !requires { &f59; }, !requires { &f60; }, !requires { &f61; }, !requires { &f62; }, !requires { &f63; }};
+    return MakeBound<std::tuple<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5), decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11), decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17), decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23), decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29), decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35), decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41), decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47), decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53), decltype(f54), decltype(f55), decltype(f56), decltype(f57), decltype(f58), decltype(f59), decltype(f60), decltype(f61), decltype(f62), decltype(f63)>>(Address<bit_fields[0]>(f0), Address<bit_fields[1]>(f1), Address<bit_fields[2]>(f2), Address<bit_fields[3]>(f3), Address<bit_fields[4]>(f4), Address<bit_fields[5]>(f5), Address<bit_fields[6]>(f6), Address<bit_fields[7]>(f7), Address<bit_fields[8]>(f8), Address<bit_fields[9]>(f9), Address<bit_fields[10]>(f10), Address<bit_fields[11]>(f11), Address<bit_fields[12]>(f12), Address<bit_fields[13]>(f13), Address<bit_fields[14]>(f14), Address<bit_fields[15]>(f15), Address<bit_fields[16]>(f16), Address<bit_fields[17]>(f17), Address<bit_fields[18]>(f18), Address<bit_fields[19]>(f19), Address<bit_fields[20]>(f20), Address<bit_fields[21]>(f21), Address<bit_fields[22]>(f22), Address<bit_fields[23]>(f23), Address<bit_fields[24]>(f24), Address<bit_fields[25]>(f25), Address<bit_fields[26]>(f26), Address<bit_fields[27]>(f27), Address<bit_fields[28]>(f28), Address<bit_fields[29]>(f29), Address<bit_fields[30]>(f30), Address<bit_fields[31]>(f31), Address<bit_fields[32]>(f32), Address<bit_fields[33]>(f33), Address<bit_fields[34]>(f34), Address<bit_fields[35]>(f35), Address<bit_fields[36]>(f36), Address<bit_fields[37]>(f37), Address<bit_fields[38]>(f38), Address<bit_fields[39]>(f39), Address<bit_fields[40]>(f40), Address<bit_fields[41]>(f41), Address<bit_fields[42]>(f42), Address<bit_fields[43]>(f43), Address<bit_fields[44]>(f44), Address<bit_fields[45]>(f45), Address<bit_fields[46]>(f46), Address<bit_fields[47]>(f47), Address<bit_fields[48]>(f48), Address<bit_fields[49]>(f49), Address<bit_fields[50]>(f50), Address<bit_fields[51]>(f51), Address<bit_fields[52]>(f52), Address<bit_fields[53]>(f53), Address<bit_fields[54]>(f54), Address<bit_fields[55]>(f55), Address<bit_fields[56]>(f56), Address<bit_fields[57]>(f57), Address<bit_fields[58]>(f58), Address<bit_fields[59]>(f59), Address<bit_fields[60]>(f60), Address<bit_fields[61]>(f61), Address<bit_fields[62]>(f62), Address<bit_fields[63]>(f63));
+}
+
+template <class T>
+using Bindings = decltype(Bind(std::declval<T &>(), Count<CountRawFields<T>()>{}));
+
+template <class U>
+inline constexpr bool kIsAnnotation = false;
+
+template <class... As>
+inline constexpr bool kIsAnnotation<Annotate<As...>> = true;
+
+template <template <class...> class Template, class A>
+inline constexpr bool kIsInstance = false;
+
+template <template <class...> class Template, class... Args>
+inline constexpr bool kIsInstance<Template, Template<Args...>> = true;
+
+template <class... Annotations>
+struct Concat {
+    using Type = Annotate<>;
+};
+
+template <class... As>
+struct Concat<Annotate<As...>> {
+    using Type = Annotate<As...>;
+};
+
+template <class... As, class... Bs, class... Rest>
+struct Concat<Annotate<As...>, Annotate<Bs...>, Rest...> : Concat<Annotate<As..., Bs...>, Rest...> {};
+
+template <template <class...> class Template, class... As>
+struct Find;
+
+template <template <class...> class Template, class A, class... As>
+struct Find<Template, A, As...> : Find<Template, As...> {};
+
+template <template <class...> class Template, class... Args, class... As>
+struct Find<Template, Template<Args...>, As...> {
+    using Type = Template<Args...>;
+};
+
+constexpr std::size_t AlignUp(std::size_t offset, std::size_t alignment) {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+// Reference members are stored as pointers.
+template <class U>
+using Stored = std::conditional_t<std::is_reference_v<U>, std::remove_reference_t<U> *, U>;
+
+// Positions and offsets of the raw fields of T. Offsets follow the usual
+// layout rules (every member aligned after the previous one), which is
+// what every mainstream ABI does for aggregates without base classes.
+// Annotations declared [[no_unique_address]] take no space; if T is too
+// small for its annotations to occupy a byte each, they are laid out that
+// way. Offsets are only provided when one of these layouts reproduces
+// sizeof(T) and T has no bit-fields; over-aligned members can still shift
+// fields without changing sizeof(T), which users of the offsets check
+// against real addresses. Field counts, types, annotations and Field::Get
+// do not depend on the offsets.
+template <class T, class B = Bindings<T>>
+struct Layout;
+
+template <class T, class... Us, class... Ps>
+struct Layout<T, Bound<std::tuple<Us...>, std::tuple<Ps...>>> {
+    static constexpr std::size_t num_raw = sizeof...(Us);
+    static constexpr std::array<bool, num_raw> is_annotation = {kIsAnnotation<Us>...};
+    static constexpr std::array<bool, num_raw> is_bit_field = {std::is_null_pointer_v<Ps>...};
+    static constexpr std::size_t num_fields = (std::size_t{0} + ... + !kIsAnnotation<Us>);
+
+    struct Placement {
+        std::array<std::size_t, num_raw> offsets{};
+        std::size_t size = 0;
+    };
+
+    static constexpr Placement Place(bool annotations_take_space) {
+        constexpr std::size_t sizes[] = {sizeof(Stored<Us>)..., 0};
+        constexpr std::size_t aligns[] = {alignof(Stored<Us>)..., 1};
+        Placement result;
+        std::size_t end = 0;
+        for (std::size_t i = 0; i < num_raw; ++i) {
+            result.offsets[i] = AlignUp(end, aligns[i]);
+            if (annotations_take_space || !is_annotation[i]) {
+                end = result.offsets[i] + sizes[i];
+            }
+        }
+        // A complete object never has size 0.
+        result.size = end == 0 ? 1 : AlignUp(end, alignof(T));
+        return result;
+    }
+
+    static constexpr Placement kPlain = Place(true);
+    static constexpr Placement kOverlapping = Place(false);
+
+    static constexpr bool has_offsets = (true && ... && !std::is_null_pointer_v<Ps>) &&
+                                        (kPlain.size == sizeof(T) || kOverlapping.size == sizeof(T));
+
+    static constexpr std::array<std::size_t, num_raw> offsets =
+        kPlain.size == sizeof(T) ? kPlain.offsets : kOverlapping.offsets;
+
+    // position[I] is the raw index of field I; annotations of field I are
+    // the raw fields in [first_annotation[I], position[I]).
+    static constexpr std::array<std::size_t, num_fields> position = [] {
+        std::array<std::size_t, num_fields> result{};
+        for (std::size_t i = 0, field = 0; i < num_raw; ++i) {
+            if (!is_annotation[i]) {
+                result[field++] = i;
+            }
+        }
+        return result;
+    }();
+
+    static constexpr std::size_t FirstAnnotation(std::size_t field) {
+        return field == 0 ? 0 : position[field - 1] + 1;
+    }
+
+    template <std::size_t I>
+    using Raw = std::tuple_element_t<I, std::tuple<Us...>>;
+
+    template <std::size_t Begin, std::size_t... Js>
+    static auto Annotations(std::index_sequence<Js...>) -> typename Concat<Raw<Begin + Js>...>::Type;
+
+    template <std::size_t I>
+    using AnnotationsOf = decltype(Annotations<FirstAnnotation(I)>(
+        std::make_index_sequence<position[I] - FirstAnnotation(I)>{}));
+};
+
+template <class T, class Annotations>
+struct FieldDescriptor;
+
+template <class T, class... As>
+struct FieldDescriptor<T, Annotate<As...>> {
+    using Annotations = Annotate<As...>;
 
     template <template <class...> class AnnotationTemplate>
-    static constexpr bool has_annotation_template = /* ... */;
-    
+    static constexpr bool has_annotation_template = (false || ... || kIsInstance<AnnotationTemplate, As>);
+
     template <class Annotation>
-    static constexpr bool has_annotation_class = /* ... */;
+    static constexpr bool has_annotation_class = (false || ... || std::is_same_v<Annotation, As>);
 
     template <template <class...> class AnnotationTemplate>
-    using FindAnnotation = /* ... */;
+    using FindAnnotation = typename Find<AnnotationTemplate, As...>::Type;
 };
 
+template <bool HasOffset, std::size_t Offset>
+struct FieldOffset {};
+
+template <std::size_t Offset>
+struct FieldOffset<true, Offset> {
+    // Byte offset of the field inside T.
+    static constexpr std::size_t offset = Offset;
+};
+
+template <class T, std::size_t I, class L = Layout<T>>
+struct Field : FieldDescriptor<T, typename L::template AnnotationsOf<I>>,
+               FieldOffset<L::has_offsets, L::offsets[L::position[I]]> {
+    using Type = typename L::template Raw<L::position[I]>;
+
+    static constexpr Type &Get(T &object) noexcept {
+        static_assert(!L::is_bit_field[L::position[I]], "Describe: a bit-field has no address to Get");
+        return *std::get<L::position[I]>(Bind(object, Count<L::num_raw>{}).pointers);
+    }
+
+    static constexpr const Type &Get(const T &object) noexcept {
+        static_assert(!L::is_bit_field[L::position[I]], "Describe: a bit-field has no address to Get");
+        return *std::get<L::position[I]>(Bind(object, Count<L::num_raw>{}).pointers);
+    }
+};
+
+} // namespace reflect_detail
+
+// Field descriptor:
+//
+//     using Type = /* type of the field */;
+//     using Annotations = Annotate</* all annotations of the field */>;
+//
+//     template <template <class...> class AnnotationTemplate>
+//     static constexpr bool has_annotation_template = /* ... */;
+//
+//     template <class Annotation>
+//     static constexpr bool has_annotation_class = /* ... */;
+//
+//     template <template <class...> class AnnotationTemplate>
+//     using FindAnnotation = /* first annotation instantiated from AnnotationTemplate */;
+//
+//     static constexpr std::size_t offset = /* byte offset of the field in T, if has_offsets */;
+//     static Type& Get(T&);              // not for bit-fields
+//     static const Type& Get(const T&);  // not for bit-fields
+//
+// Annotations of a field are the Annotate<...> members declared right
+// before it; several of them are concatenated. Bit-fields and reference
+// members are fields too: Type is the declared type (int for int x : 3,
+// int& for a reference member) and Get of a reference member returns the
+// object it refers to.
 template <class T>
+    requires std::is_aggregate_v<T>
 struct Describe {
-    static constexpr std::size_t num_fields = /* number of fields */
-    
+    static constexpr std::size_t num_fields = reflect_detail::Layout<T>::num_fields;
+
+    // Whether Field::offset is available: T has no bit-fields and its
+    // size matches the computed layout.
+    static constexpr bool has_offsets = reflect_detail::Layout<T>::has_offsets;
+
     template <std::size_t I>
-    using Field = /* field descriptor */;
+        requires(I < num_fields)
+    using Field = reflect_detail::Field<T, I>;
 };
+
+// Helpers shared by the headers built on Describe.
+namespace reflect_detail {
+
+template <class U>
+inline constexpr bool kIsStdArray = false;
+
+template <class E, std::size_t N>
+inline constexpr bool kIsStdArray<std::array<E, N>> = true;
+
+template <class U>
+inline constexpr bool kDependentFalse = false;
+
+// Fields of T selected by Selected<T, I>::value that touch each other in
+// memory form a run, which can be copied, compared or hashed with one call.
+// Nothing is selected when T has no offsets.
+template <class T, template <class, std::size_t> class Selected>
+struct Runs {
+    static constexpr std::size_t num_fields = Describe<T>::num_fields;
+
+    template <std::size_t... Is>
+    static constexpr std::array<bool, num_fields> Select(std::index_sequence<Is...>) {
+        if constexpr (Describe<T>::has_offsets) {
+            return {Selected<T, Is>::value...};
+        } else {
+            return {};
+        }
+    }
+
+    template <std::size_t... Is>
+    static constexpr std::array<std::size_t, num_fields> Offsets(std::index_sequence<Is...>) {
+        if constexpr (Describe<T>::has_offsets) {
+            return {Field<T, Is>::offset...};
+        } else {
+            return {};
+        }
+    }
+
+    template <std::size_t... Is>
+    static constexpr std::array<std::size_t, num_fields> Ends(std::index_sequence<Is...>) {
+        return {(offsets[Is] + sizeof(typename Field<T, Is>::Type))...};
+    }
+
+    static constexpr std::array<bool, num_fields> selected = Select(std::make_index_sequence<num_fields>{});
+    static constexpr std::array<std::size_t, num_fields> offsets = Offsets(std::make_index_sequence<num_fields>{});
+    static constexpr std::array<std::size_t, num_fields> ends = Ends(std::make_index_sequence<num_fields>{});
+
+    static constexpr bool Joined(std::size_t i) {
+        return i > 0 && selected[i - 1] && selected[i] && ends[i - 1] == offsets[i];
+    }
+
+    // End offset of the run that starts at field I, 0 if field I is not
+    // selected or continues the run of the previous field.
+    static constexpr std::array<std::size_t, num_fields> run_end = [] {
+        std::array<std::size_t, num_fields> result{};
+        for (std::size_t i = 0; i < num_fields; ++i) {
+            if (selected[i] && !Joined(i)) {
+                std::size_t last = i;
+                while (last + 1 < num_fields && Joined(last + 1)) {
+                    ++last;
+                }
+                result[i] = ends[last];
+            }
+        }
+        return result;
+    }();
+
+    // One run covers T without a gap, so T has no padding and every field
+    // is selected: T can be handled as a single block of bytes. Fields that
+    // tile T in declaration order can only sit at these offsets.
+    static constexpr bool whole = num_fields > 0 && offsets[0] == 0 && run_end[0] == sizeof(T);
+
+    template <std::size_t I>
+    static bool AtOffset(const T &object) noexcept {
+        if constexpr (selected[I]) {
+            const auto *field = reinterpret_cast<const unsigned char *>(std::addressof(Field<T, I>::Get(object)));
+            return field - reinterpret_cast<const unsigned char *>(std::addressof(object)) ==
+                   static_cast<std::ptrdiff_t>(offsets[I]);
+        } else {
+            return true;
+        }
+    }
+
+    // Whether the selected fields of object sit at the computed offsets.
+    // An over-aligned member (alignas) can move fields without changing
+    // sizeof(T); callers then go field by field. The check folds to a
+    // constant once optimized.
+    static bool Hold(const T &object) noexcept {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            return (true && ... && AtOffset<Is>(object));
+        }(std::make_index_sequence<num_fields>{});
+    }
+};
+
+} // namespace reflect_detail
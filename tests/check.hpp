@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+// Runtime check for the header tests that stays on under NDEBUG: prints the
+// failed condition and aborts, which ctest reports as a failure.
+#define CHECK(condition) ((condition) ? void() : ::check_detail::Fail(#condition, __FILE__, __LINE__))
+
+namespace check_detail {
+
+[[noreturn]] inline void Fail(const char *condition, const char *file, int line) {
+    std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", file, line, condition);
+    std::abort();
+}
+
+} // namespace check_detail
@@ -0,0 +1,111 @@
+#include <compare>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <Compare.hpp>
+#include <check.hpp>
+
+struct Key {
+    std::uint32_t a;
+    std::uint32_t b;
+    std::uint64_t c;
+};
+
+struct Mixed {
+    std::uint32_t a;
+    std::uint16_t b;
+    std::uint16_t c;
+    double d;
+    Annotate<compare::Ignore> _cache;
+    int cache;
+    std::string name;
+    Key key;
+    std::vector<int> values;
+};
+
+struct Names {
+    std::string first;
+    std::string second;
+};
+
+// Inner has no operators of its own, so the containers below have none
+// either.
+struct Inner {
+    int a;
+    double b;
+};
+
+struct Outer {
+    std::vector<Inner> v;
+    std::array<Inner, 2> pair;
+    std::optional<Inner> maybe;
+    std::vector<std::optional<Inner>> nested;
+};
+
+// The computed layout puts d right after c, but alignas moves it past a
+// padding byte: the run of i, c and d must not be compared at once.
+struct Shifted {
+    std::int32_t i;
+    char c;
+    alignas(2) char d;
+};
+
+static_assert(compare::detail::Runs<Key>::whole);
+static_assert(!compare::detail::Runs<Mixed>::whole);
+static_assert(compare::detail::Runs<Mixed>::run_end[0] == 8);
+static_assert(std::is_same_v<decltype(compare::ThreeWay(Key{}, Key{})), std::strong_ordering>);
+static_assert(std::is_same_v<decltype(compare::ThreeWay(Mixed{}, Mixed{})), std::partial_ordering>);
+static_assert(std::is_same_v<decltype(compare::ThreeWay(Outer{}, Outer{})), std::partial_ordering>);
+
+int main() {
+    Mixed x{1, 2, 3, 0.0, {}, 5, "n", {1, 2, 3}, {1, 2}};
+    Mixed y = x;
+    y.cache = 99;
+    y.d = -0.0;
+    CHECK(compare::Equal(x, y) && compare::Hash(x) == compare::Hash(y) && compare::ThreeWay(x, y) == 0);
+    y.name = "o";
+    CHECK(!compare::Equal(x, y) && compare::ThreeWay(x, y) < 0);
+
+    // Lengths are hashed, so moving a character between fields changes the hash.
+    CHECK(compare::Hash(Names{"ab", ""}) != compare::Hash(Names{"a", "b"}));
+
+    std::unordered_set<Key, compare::Hasher<Key>, compare::EqualTo<Key>> unique{{1, 2, 3}, {1, 2, 3}, {2, 2, 3}};
+    CHECK(unique.size() == 2);
+    std::set<Key, compare::Less<Key>> ordered{{2, 0, 0}, {1, 5, 0}, {1, 4, 9}};
+    CHECK(ordered.begin()->b == 4);
+
+    // Ranges and optionals of aggregates are compared element by element.
+    const Outer outer{{{1, 1.5}, {2, 2.5}}, {{{3, 0}, {4, 0}}}, Inner{5, 0}, {std::nullopt, Inner{6, 0}}};
+    Outer other = outer;
+    CHECK(compare::Equal(outer, other) && compare::ThreeWay(outer, other) == 0 &&
+          compare::Hash(outer) == compare::Hash(other));
+    other.v.pop_back();
+    CHECK(!compare::Equal(outer, other) && compare::ThreeWay(other, outer) < 0);
+    other = outer;
+    other.pair[1].b = -0.0;
+    CHECK(compare::Equal(outer, other) && compare::Hash(outer) == compare::Hash(other));
+    other.maybe.reset();
+    CHECK(!compare::Equal(outer, other) && compare::ThreeWay(other, outer) < 0 &&
+          compare::Hash(outer) != compare::Hash(other));
+    other = outer;
+    other.nested[1]->a = 7;
+    CHECK(!compare::Equal(outer, other) && compare::ThreeWay(outer, other) < 0);
+    CHECK(compare::Hash(std::optional<int>{}) != compare::Hash(std::optional<int>{0}));
+
+    alignas(Shifted) unsigned char first[sizeof(Shifted)];
+    alignas(Shifted) unsigned char second[sizeof(Shifted)];
+    std::memset(first, 0xaa, sizeof(first));
+    std::memset(second, 0x55, sizeof(second));
+    Shifted *a = new (first) Shifted{1, 'c', 'd'};
+    Shifted *b = new (second) Shifted{1, 'c', 'd'};
+    CHECK(compare::Equal(*a, *b) && compare::Hash(*a) == compare::Hash(*b));
+    b->d = 'e';
+    CHECK(!compare::Equal(*a, *b) && compare::Hash(*a) != compare::Hash(*b));
+}
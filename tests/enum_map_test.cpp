@@ -0,0 +1,40 @@
+#include <iterator>
+#include <stdexcept>
+
+#include <EnumMap.hpp>
+#include <check.hpp>
+
+enum class Color : int { Red = -300, Green = 0, Blue = 5, Alpha = 400 };
+
+static_assert(std::forward_iterator<EnumMap<Color, int>::iterator>);
+static_assert(EnumMap<Color, int>::size() == 4);
+
+constexpr bool Weighted() {
+    EnumMap<Color, int> map;
+    map[Color::Alpha] = 4;
+    map.at(Color::Red) = 1;
+    int sum = 0;
+    for (auto [key, value] : map) {
+        sum += value * (key == Color::Alpha ? 10 : 1);
+    }
+    return sum == 41 && map.contains(Color::Blue) && !map.contains(static_cast<Color>(3));
+}
+static_assert(Weighted());
+
+int main() {
+    EnumMap<Color, int> map;
+    map.fill(7);
+    CHECK(map[Color::Green] == 7 && map.data()[3] == 7);
+    EnumMap<Color, int> copy = map;
+    CHECK(copy == map);
+    copy[Color::Blue] = 0;
+    CHECK(copy != map);
+
+    bool thrown = false;
+    try {
+        map.at(static_cast<Color>(3));
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
@@ -0,0 +1,53 @@
+#include <iterator>
+
+#include <EnumSet.hpp>
+#include <check.hpp>
+
+enum class Color : int { Red = -300, Green = 0, Blue = 5, Alpha = 400 };
+
+// More enumerators than one 64-bit word holds.
+enum class Many {
+#define MANY(n) v##n##0, v##n##1, v##n##2, v##n##3, v##n##4, v##n##5, v##n##6, v##n##7, v##n##8, v##n##9,
+    MANY(0) MANY(1) MANY(2) MANY(3) MANY(4) MANY(5) MANY(6)
+#undef MANY
+};
+
+enum class Empty {};
+
+static_assert(std::forward_iterator<EnumSet<Color>::iterator>);
+
+constexpr bool Operations() {
+    EnumSet<Color> set{Color::Red, Color::Alpha};
+    if (set.size() != 2 || !set.contains(Color::Alpha) || set.contains(Color::Green)) {
+        return false;
+    }
+    if (set.insert(Color::Red) || !set.insert(Color::Blue) || set.insert(static_cast<Color>(7))) {
+        return false;
+    }
+    const EnumSet<Color> rest = ~set;
+    if (rest.size() != 1 || !rest.contains(Color::Green) || (set | rest) != EnumSet<Color>::all()) {
+        return false;
+    }
+    if (!(set & rest).empty() || (set ^ EnumSet<Color>::all()) != rest) {
+        return false;
+    }
+    return set.erase(Color::Red) && !set.erase(Color::Red) && set.size() == 2;
+}
+static_assert(Operations());
+
+static_assert(EnumSet<Many>::all().size() == 70);
+static_assert((~EnumSet<Many>{Many::v03, Many::v69}).size() == 68);
+static_assert(EnumSet<Empty>{}.empty() && EnumSet<Empty>::all().size() == 0);
+
+int main() {
+    EnumSet<Many> set{Many::v01, Many::v65, Many::v63, Many::v64};
+    Many expected[] = {Many::v01, Many::v63, Many::v64, Many::v65};
+    std::size_t i = 0;
+    for (const Many value : set) {
+        CHECK(i < 4 && value == expected[i]);
+        ++i;
+    }
+    CHECK(i == 4);
+    set.clear();
+    CHECK(set.empty() && set.begin() == set.end());
+}
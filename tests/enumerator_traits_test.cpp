@@ -0,0 +1,51 @@
+#include <string_view>
+
+#include <EnumeratorTraits.hpp>
+#include <check.hpp>
+
+namespace ns {
+enum class Sparse : int { A = -3, B = 0, C = 5, D = 100, Z = 600 };
+}
+
+enum Plain : unsigned char { P0, P1 = 200, P2 = 255 };
+enum class Dense { a, b, c, d };
+enum class Empty {};
+enum class Letter : char { Neg = -5, A = 'a', B = 'b' };
+enum class Wide : wchar_t { X = L'x', Y = 1000 };
+enum class Byte : char8_t { Lo = 1, Hi = 250 };
+enum class Flag : bool { No, Yes };
+
+template <class Traits>
+constexpr bool RoundTrips() {
+    for (std::size_t i = 0; i < Traits::size(); ++i) {
+        if (Traits::indexOf(Traits::at(i)) != i || Traits::indexOfName(Traits::nameAt(i)) != i ||
+            Traits::nameOf(Traits::at(i)) != Traits::nameAt(i)) {
+            return false;
+        }
+    }
+    return Traits::indexOfName("nope") == Traits::size() && !Traits::fromName("").has_value();
+}
+
+using Sparse = EnumeratorTraits<ns::Sparse>;
+
+// Z = 600 lies outside the default search range.
+static_assert(Sparse::size() == 4 && RoundTrips<Sparse>());
+static_assert(Sparse::nameOf(ns::Sparse::C) == "C" && *Sparse::fromName("D") == ns::Sparse::D);
+static_assert(Sparse::nameOf(static_cast<ns::Sparse>(1)).empty());
+static_assert(EnumeratorTraits<Plain, 1000>::size() == 3 && RoundTrips<EnumeratorTraits<Plain, 1000>>());
+static_assert(EnumeratorTraits<Dense>::size() == 4 && RoundTrips<EnumeratorTraits<Dense>>());
+static_assert(EnumeratorTraits<Empty>::size() == 0 && RoundTrips<EnumeratorTraits<Empty>>());
+
+// Character and bool underlying types.
+static_assert(EnumeratorTraits<Letter>::size() == 3 && RoundTrips<EnumeratorTraits<Letter>>());
+static_assert(EnumeratorTraits<Letter>::nameAt(0) == "Neg" && EnumeratorTraits<Letter>::indexOf(Letter::B) == 2);
+static_assert(EnumeratorTraits<Wide, 1000>::size() == 2 && RoundTrips<EnumeratorTraits<Wide, 1000>>());
+static_assert(EnumeratorTraits<Byte>::size() == 2 && RoundTrips<EnumeratorTraits<Byte>>());
+static_assert(EnumeratorTraits<Flag>::size() == 2 && RoundTrips<EnumeratorTraits<Flag>>());
+
+int main() {
+    CHECK(Sparse::nameAt(0) == "A" && Sparse::at(3) == ns::Sparse::D);
+    CHECK(Sparse::indexOfName("B") == 1);
+    CHECK((EnumeratorTraits<Plain, 1000>::nameOf(P1) == "P1"));
+    CHECK(EnumeratorTraits<Letter>::nameOf(Letter::A) == "A" && EnumeratorTraits<Byte>::indexOf(Byte::Hi) == 1);
+}
@@ -0,0 +1,20 @@
+#include <string_view>
+
+#include <FixedString.hpp>
+#include <check.hpp>
+
+template <FixedString<256> Name>
+struct Column {
+    static constexpr std::string_view name = Name;
+};
+
+static_assert(Column<"price"_cstr>::name == "price");
+static_assert(Column<""_cstr>::name.empty());
+static_assert(std::string_view(FixedString<8>("abc", 3)) == "abc");
+
+int main() {
+    constexpr FixedString<16> key("key", 3);
+    const std::string_view view = key;
+    CHECK(view.size() == 3 && view == "key");
+    CHECK(Column<"quantity"_cstr>::name.size() == 8);
+}
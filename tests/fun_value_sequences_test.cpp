@@ -0,0 +1,19 @@
+#include <type_traits>
+
+#include <fun_value_sequences.hpp>
+#include <check.hpp>
+
+template <class T>
+struct IsOdd {
+    static constexpr bool Value = T::Value % 2 != 0;
+};
+
+static_assert(std::is_same_v<ToTuple<Take<5, Nats>>, VTuple<int, 0, 1, 2, 3, 4>>);
+static_assert(std::is_same_v<ToTuple<Take<8, Fib>>, VTuple<int, 0, 1, 1, 2, 3, 5, 8, 13>>);
+static_assert(std::is_same_v<ToTuple<Take<6, Primes>>, VTuple<int, 2, 3, 5, 7, 11, 13>>);
+static_assert(std::is_same_v<ToTuple<Take<3, Filter<IsOdd, Nats>>>, VTuple<int, 1, 3, 5>>);
+static_assert(Foldl<Plus, ValueTag<0>, Take<10, Nats>>::Value == 45);
+
+int main() {
+    CHECK(IsPrime(97) && !IsPrime(91) && !IsPrime(1));
+}
@@ -0,0 +1,96 @@
+#include <array>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Json.hpp>
+#include <check.hpp>
+
+enum class Side { Buy = 1, Sell = 2 };
+
+struct Level {
+    Annotate<json::Name<"px"_cstr>> _px;
+    double px;
+    Annotate<json::Name<"qty"_cstr>> _qty;
+    long qty;
+};
+
+struct Quote {
+    Annotate<json::Name<"symbol"_cstr>> _symbol;
+    std::string symbol;
+    Annotate<json::Name<"bid"_cstr>> _bid;
+    double bid;
+    int cache;
+    Annotate<json::Name<"side"_cstr>> _side;
+    Side side;
+    Annotate<json::Name<"live"_cstr>> _live;
+    bool live;
+    Annotate<json::Name<"levels"_cstr>> _levels;
+    std::vector<Level> levels;
+    Annotate<json::Name<"venue"_cstr>> _venue;
+    std::optional<std::string> venue;
+    Annotate<json::Name<"tag"_cstr>> _tag;
+    std::string_view tag;
+    Annotate<json::Name<"sizes"_cstr>> _sizes;
+    std::array<int, 2> sizes;
+};
+
+static_assert(json::detail::Keys<Quote>::Find("levels") == 5);
+static_assert(json::detail::Keys<Quote>::Find("cache") == json::detail::Keys<Quote>::num_fields);
+
+bool Rejects(std::string_view input) {
+    try {
+        json::Read<Quote>(input);
+    } catch (const json::ParseError &) {
+        return true;
+    }
+    return false;
+}
+
+int main() {
+    const Quote quote{{}, "A\"B\n", {}, 1.25, 7, {}, Side::Sell, {}, true, {}, {{{}, 1.5, {}, 10}},
+                      {}, std::nullopt, {}, "t", {}, {3, 4}};
+    const std::string text = json::Write(quote);
+    const Quote read = json::Read<Quote>(text);
+    CHECK(read.symbol == quote.symbol && read.bid == 1.25 && read.cache == 0 && read.side == Side::Sell);
+    CHECK(read.live && read.levels.size() == 1 && read.levels[0].qty == 10 && !read.venue && read.tag == "t");
+    CHECK(read.sizes[1] == 4);
+
+    const Quote other = json::Read<Quote>(
+        R"( { "unknown": {"a": [1, 2, {"x": null}], "b": "A"}, "venue": "Xé😀", "bid": -3e2 } )");
+    CHECK(other.bid == -300 && *other.venue == "X\xc3\xa9\xf0\x9f\x98\x80");
+
+    CHECK(Rejects(R"({"bid": "x"})"));
+    CHECK(Rejects(R"({"bid": 1} x)"));
+    CHECK(Rejects(R"({"symbol": "\ud83d"})"));
+    CHECK(Rejects(R"({"symbol": "\ud83dA"})"));
+    CHECK(Rejects(R"({"symbol": "\ude00"})"));
+    CHECK(Rejects("{\"symbol\": \"a\tb\"}"));
+    CHECK(Rejects(R"({"bid": 01})"));
+    CHECK(Rejects(R"({"bid": .5})"));
+    CHECK(Rejects(R"({"bid": 1.})"));
+    CHECK(Rejects(R"({"bid": +1})"));
+    CHECK(Rejects(R"({"unknown": 00})"));
+
+    // Unknown numbers are checked against the grammar only.
+    CHECK(json::Read<Quote>(R"({"bid": 1, "zz": 1e999, "yy": -123456789012345678901234567890})").bid == 1);
+    CHECK(Rejects(R"({"bid": 1e999})"));
+
+    // Non-finite values are written as null and read back as NaN.
+    Quote infinite = quote;
+    infinite.bid = std::numeric_limits<double>::infinity();
+    CHECK(std::isnan(json::Read<Quote>(json::Write(infinite)).bid));
+
+    // Nesting is limited whether or not the key is known.
+    const auto nested = [](std::string_view key, std::size_t depth) {
+        return "{\"" + std::string(key) + "\": " + std::string(depth, '[') + std::string(depth, ']') + "}";
+    };
+    CHECK(!Rejects(nested("unknown", json::kMaxDepth - 1)));
+    CHECK(Rejects(nested("unknown", json::kMaxDepth)));
+    CHECK(Rejects(nested("unknown", 1000000)));
+    CHECK(Rejects("{\"unknown\": " + std::string(1000000, '{')));
+    CHECK(Rejects(nested("levels", json::kMaxDepth)));
+}
@@ -0,0 +1,69 @@
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <Layout.hpp>
+#include <check.hpp>
+
+enum class Kind : std::uint8_t { A, B, C };
+
+struct Order {
+    char side;
+    double price;
+    bool live;
+    std::int64_t quantity;
+    Annotate<layout::Bits<3>> _kind;
+    Kind kind;
+    Annotate<layout::Bits<5>> _delta;
+    std::int16_t delta;
+    std::string name;
+};
+
+// A 64-bit field three bits into the bit area spans nine bytes.
+struct Wide {
+    Annotate<layout::Bits<1>> _flag;
+    bool flag;
+    Annotate<layout::Bits<2>> _small;
+    std::uint8_t small;
+    Annotate<layout::Bits<64>> _wide;
+    std::int64_t wide;
+    Annotate<layout::Bits<13>> _signed;
+    int value;
+};
+
+using R = layout::Report<Order>;
+
+static_assert(R::size == sizeof(Order) && R::num_fields == 7);
+static_assert(R::padding_before[1] == 7 && R::padding_before[4] == 1);
+static_assert(R::used == 1 + 8 + 1 + 8 + 1 + 2 + sizeof(std::string));
+static_assert(R::wasted == sizeof(Order) - R::used);
+static_assert(R::packed_size == 56 && sizeof(layout::PackedStorage<Order>) == R::packed_size);
+static_assert(sizeof(layout::PackedStorage<Wide>) == 10);
+
+int main() {
+    const Order order{'B', 1.5, true, -7, {}, Kind::C, {}, -9, "a name long enough to live on the heap"};
+    layout::PackedStorage<Order> packed(order);
+    CHECK(packed.get<0>() == 'B' && packed.get<1>() == 1.5 && packed.get<2>() && packed.get<3>() == -7);
+    CHECK(packed.get<4>() == Kind::C && packed.get<5>() == -9 && packed.get<6>() == order.name);
+
+    packed.set<5>(15);
+    CHECK(packed.get<5>() == 15);
+    packed.set<5>(-16);
+    packed.set<4>(Kind::B);
+    CHECK(packed.get<4>() == Kind::B && packed.get<5>() == -16);
+
+    layout::PackedStorage<Order> copy = packed;
+    layout::PackedStorage<Order> moved = std::move(copy);
+    const Order unpacked = moved.unpack();
+    CHECK(unpacked.name == order.name && unpacked.kind == Kind::B && unpacked.delta == -16);
+
+    layout::PackedStorage<Wide> wide;
+    wide.set<2>(INT64_MIN + 5);
+    wide.set<0>(true);
+    wide.set<3>(-4096);
+    wide.set<1>(3);
+    CHECK(wide.get<0>() && wide.get<1>() == 3 && wide.get<2>() == INT64_MIN + 5 && wide.get<3>() == -4096);
+    wide.set<2>(-1);
+    wide.set<0>(false);
+    CHECK(!wide.get<0>() && wide.get<1>() == 3 && wide.get<2>() == -1 && wide.get<3>() == -4096);
+}
@@ -0,0 +1,26 @@
+#include <optional>
+
+#include <PolymorphicMapper.hpp>
+#include <check.hpp>
+
+struct Shape {
+    virtual ~Shape() = default;
+};
+
+struct Circle : Shape {};
+struct Square : Shape {};
+struct Ellipse : Circle {};
+struct Triangle : Shape {};
+
+enum class Kind { Circle, Square };
+
+using KindOf = PolymorphicMapper<Shape, Kind, Mapping<Square, Kind::Square>, Mapping<Circle, Kind::Circle>>;
+using None = PolymorphicMapper<Shape, Kind>;
+
+int main() {
+    CHECK(KindOf::map(Circle{}) == Kind::Circle);
+    CHECK(KindOf::map(Square{}) == Kind::Square);
+    CHECK(KindOf::map(Ellipse{}) == Kind::Circle);
+    CHECK(!KindOf::map(Triangle{}).has_value());
+    CHECK(!None::map(Circle{}).has_value());
+}
@@ -0,0 +1,116 @@
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include <reflect.hpp>
+#include <check.hpp>
+
+template <class...>
+struct Range {};
+
+struct NoDefault {};
+
+struct Inner {
+    int a;
+    double b;
+};
+
+struct Record {
+    Annotate<NoDefault> _x;
+    int x;
+    Annotate<Range<int>> _y;
+    Annotate<NoDefault, Range<char>> _y2;
+    double y;
+    std::string name;
+    Inner inner;
+    char tag;
+};
+
+struct Empty {};
+
+// Annotations declared [[no_unique_address]] take no space.
+struct Compact {
+    [[no_unique_address]] Annotate<NoDefault> _a;
+    int a;
+    [[no_unique_address]] Annotate<Range<int>> _b;
+    char b;
+};
+
+// Bit-fields have no offsets or address, but still count and keep their
+// declared types and annotations.
+struct Bits {
+    Annotate<NoDefault> _low;
+    unsigned low : 3;
+    unsigned high : 5;
+    const long count;
+};
+
+struct Refs {
+    int &target;
+    Annotate<Range<int>> _limit;
+    const long limit;
+};
+
+// sizeof(Aligned) does not match the computed layout: no offsets.
+struct Aligned {
+    char c;
+    alignas(16) int x;
+};
+
+using D = Describe<Record>;
+
+static_assert(D::num_fields == 5);
+static_assert(std::is_same_v<D::Field<0>::Type, int>);
+static_assert(std::is_same_v<D::Field<2>::Type, std::string>);
+static_assert(std::is_same_v<D::Field<3>::Type, Inner>);
+static_assert(std::is_same_v<D::Field<0>::Annotations, Annotate<NoDefault>>);
+static_assert(std::is_same_v<D::Field<1>::Annotations, Annotate<Range<int>, NoDefault, Range<char>>>);
+static_assert(std::is_same_v<D::Field<2>::Annotations, Annotate<>>);
+static_assert(D::Field<1>::has_annotation_template<Range> && !D::Field<0>::has_annotation_template<Range>);
+static_assert(D::Field<1>::has_annotation_class<NoDefault>);
+static_assert(std::is_same_v<D::Field<1>::FindAnnotation<Range>, Range<int>>);
+static_assert(D::Field<0>::offset == offsetof(Record, x) && D::Field<1>::offset == offsetof(Record, y) &&
+              D::Field<2>::offset == offsetof(Record, name) && D::Field<3>::offset == offsetof(Record, inner) &&
+              D::Field<4>::offset == offsetof(Record, tag));
+static_assert(Describe<Empty>::num_fields == 0);
+static_assert(sizeof(Compact) == 8 && Describe<Compact>::num_fields == 2);
+static_assert(Describe<Compact>::Field<1>::offset == offsetof(Compact, b));
+static_assert(D::has_offsets && Describe<Compact>::has_offsets);
+
+static_assert(Describe<Bits>::num_fields == 3 && !Describe<Bits>::has_offsets);
+static_assert(std::is_same_v<Describe<Bits>::Field<0>::Type, unsigned>);
+static_assert(std::is_same_v<Describe<Bits>::Field<0>::Annotations, Annotate<NoDefault>>);
+static_assert(std::is_same_v<Describe<Bits>::Field<2>::Type, const long>);
+
+static_assert(Describe<Refs>::num_fields == 2 && Describe<Refs>::has_offsets);
+static_assert(std::is_same_v<Describe<Refs>::Field<0>::Type, int &>);
+static_assert(Describe<Refs>::Field<1>::has_annotation_template<Range>);
+
+static_assert(Describe<Aligned>::num_fields == 2 && !Describe<Aligned>::has_offsets);
+static_assert(std::is_same_v<Describe<Aligned>::Field<1>::Type, int>);
+
+int main() {
+    Record record{};
+    D::Field<2>::Get(record) = "name";
+    D::Field<3>::Get(record).b = 2.5;
+    D::Field<4>::Get(record) = 'x';
+    CHECK(record.name == "name" && record.inner.b == 2.5 && record.tag == 'x');
+
+    Compact compact{};
+    CHECK(&Describe<Compact>::Field<0>::Get(compact) == &compact.a);
+    CHECK(&Describe<Compact>::Field<1>::Get(compact) == &compact.b);
+
+    const Bits bits{{}, 5, 17, 3};
+    CHECK(Describe<Bits>::Field<2>::Get(bits) == 3);
+
+    int target = 1;
+    const Refs refs{target, {}, 2};
+    Describe<Refs>::Field<0>::Get(refs) = 7;
+    CHECK(target == 7 && Describe<Refs>::Field<1>::Get(refs) == 2);
+    CHECK(reinterpret_cast<const char *>(&refs.limit) - reinterpret_cast<const char *>(&refs) ==
+          static_cast<std::ptrdiff_t>(Describe<Refs>::Field<1>::offset));
+
+    Aligned aligned{};
+    Describe<Aligned>::Field<1>::Get(aligned) = 9;
+    CHECK(aligned.x == 9);
+}
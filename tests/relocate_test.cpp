@@ -0,0 +1,167 @@
+#include <array>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Relocate.hpp>
+#include <check.hpp>
+
+struct Node {
+    Node *self;
+};
+
+struct WithArray {
+    int a[3];
+    double d;
+};
+
+struct Row {
+    int a;
+    std::unique_ptr<int> p;
+    std::vector<double> v;
+    std::optional<std::unique_ptr<int>> o;
+    std::array<std::shared_ptr<int>, 2> shared;
+};
+
+struct WithString {
+    int a;
+    std::string s;
+};
+
+struct Forced {
+    Annotate<relocate::Trivially> _s;
+    std::string s;
+    int x;
+};
+
+struct Pinned {
+    Node *self;
+    Annotate<relocate::Never> _p;
+    std::unique_ptr<int> p;
+};
+
+class Declared {
+public:
+    using trivially_relocatable = std::true_type;
+    Declared() {}
+    Declared(const Declared &) {}
+    ~Declared() {}
+};
+
+static_assert(relocate::kTrivial<int> && relocate::kTrivial<WithArray> && relocate::kTrivial<Row>);
+static_assert(!relocate::kTrivial<WithString> && !relocate::kTrivial<std::string>);
+static_assert(relocate::kTrivial<Forced> && !relocate::kTrivial<Pinned> && relocate::kTrivial<Declared>);
+
+// Copies throw once the budget runs out.
+struct Fragile {
+    static inline int live = 0;
+    static inline int budget = 1 << 30;
+
+    std::string s = "long enough to allocate on the heap";
+
+    Fragile() {
+        ++live;
+    }
+
+    Fragile(const Fragile &other) : s(other.s) {
+        if (--budget < 0) {
+            throw std::runtime_error("copy failed");
+        }
+        ++live;
+    }
+
+    Fragile(Fragile &&other) noexcept : s(std::move(other.s)) {
+        ++live;
+    }
+
+    ~Fragile() {
+        --live;
+    }
+};
+
+// Moves and copies throw once the budget runs out.
+struct Sticky {
+    static inline int budget = 1 << 30;
+
+    std::string s;
+
+    explicit Sticky(std::string s) : s(std::move(s)) {
+    }
+
+    Sticky(const Sticky &other) : s(other.s) {
+        Spend();
+    }
+
+    Sticky(Sticky &&other) : s(std::move(other.s)) {
+        Spend();
+    }
+
+    static void Spend() {
+        if (--budget < 0) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+};
+
+int main() {
+    RelocatingVector<Row> rows;
+    for (int i = 0; i < 1000; ++i) {
+        rows.emplace_back(Row{i, std::make_unique<int>(i), {1.0 * i}, std::make_unique<int>(2 * i),
+                              {std::make_shared<int>(i), nullptr}});
+    }
+    for (int i = 0; i < 1000; ++i) {
+        CHECK(*rows[i].p == i && **rows[i].o == 2 * i && rows[i].v[0] == i && *rows[i].shared[0] == i);
+    }
+
+    RelocatingVector<std::string> strings;
+    for (int i = 0; i < 100; ++i) {
+        strings.push_back(std::to_string(i) + std::string(i % 2 ? 0 : 40, 'x'));
+    }
+    strings.emplace_back(strings[0]);
+    CHECK(strings.size() == 101 && strings[100] == strings[0] && strings[3] == "3");
+    RelocatingVector<std::string> copy = strings;
+    RelocatingVector<std::string> moved = std::move(copy);
+    CHECK(moved.size() == 101 && copy.empty());
+    moved.pop_back();
+    moved = strings;
+    CHECK(moved.size() == 101);
+
+    {
+        RelocatingVector<Fragile> fragile;
+        for (int i = 0; i < 10; ++i) {
+            fragile.emplace_back();
+        }
+        Fragile::budget = 5;
+        bool thrown = false;
+        try {
+            RelocatingVector<Fragile> failed(fragile);
+        } catch (const std::runtime_error &) {
+            thrown = true;
+        }
+        CHECK(thrown && Fragile::live == 10);
+    }
+    CHECK(Fragile::live == 0);
+
+    // Growth copies elements whose move may throw, so a failure keeps them.
+    RelocatingVector<Sticky> sticky;
+    for (int i = 0; i < 8; ++i) {
+        sticky.emplace_back(std::to_string(i));
+    }
+    CHECK(sticky.capacity() == 8);
+    Sticky::budget = 3;
+    bool thrown = false;
+    try {
+        sticky.emplace_back("8");
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    CHECK(thrown && sticky.size() == 8 && sticky.capacity() == 8);
+    for (int i = 0; i < 8; ++i) {
+        CHECK(sticky[i].s == std::to_string(i));
+    }
+    Sticky::budget = 1 << 30;
+    sticky.emplace_back("8");
+    CHECK(sticky.size() == 9 && sticky[0].s == "0" && sticky[8].s == "8");
+}
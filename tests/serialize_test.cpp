@@ -0,0 +1,159 @@
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Serialize.hpp>
+#include <check.hpp>
+
+enum class Side : std::int8_t { Buy = 1, Sell = -1 };
+
+struct Inner {
+    int a;
+    short b;
+};
+
+struct Order {
+    std::uint64_t id;
+    std::int32_t price;
+    Inner inner;
+    Annotate<serialize::Varint> _quantity;
+    std::int64_t quantity;
+    Annotate<serialize::BigEndian> _venue;
+    std::uint32_t venue;
+    Annotate<serialize::Skip> _cache;
+    double cache;
+    Side side;
+    bool live;
+    std::string symbol;
+    std::vector<Inner> fills;
+    std::vector<std::string> notes;
+    std::string_view view;
+    std::span<const std::byte> blob;
+    std::array<int, 3> levels;
+};
+
+struct Padded {
+    char c;
+    std::int64_t x;
+};
+
+struct Flag {
+    bool on;
+    std::uint8_t level;
+};
+
+struct Small {
+    Annotate<serialize::Varint> _u;
+    std::uint8_t u;
+    Annotate<serialize::Varint> _s;
+    std::int16_t s;
+    Annotate<serialize::Varint> _wide;
+    std::uint64_t wide;
+};
+
+bool Rejects(std::initializer_list<int> bytes) {
+    std::vector<std::byte> input;
+    for (const int byte : bytes) {
+        input.push_back(static_cast<std::byte>(byte));
+    }
+    try {
+        serialize::Deserialize<Small>(input);
+    } catch (const serialize::DecodeError &) {
+        return true;
+    }
+    return false;
+}
+
+struct Tight {
+    std::int32_t a;
+    std::int32_t b;
+};
+
+// The computed layout puts d at 5 and matches sizeof, but alignas moves d
+// to 6: the run of i, c and d must not be copied at once.
+struct Shifted {
+    std::int32_t i;
+    char c;
+    alignas(2) char d;
+};
+
+// No offsets at all: written field by field.
+struct Aligned {
+    char c;
+    alignas(16) std::int32_t x;
+};
+
+using serialize::detail::IsBlock;
+using serialize::detail::Runs;
+
+// id and price touch; Inner's tail padding ends the run.
+static_assert(Runs<Order>::run_end[0] == offsetof(Order, inner));
+static_assert(IsBlock<Tight>() && !IsBlock<Padded>() && !IsBlock<bool>());
+
+int main() {
+    const std::byte raw[3] = {std::byte{1}, std::byte{2}, std::byte{3}};
+    const Order order{1, -5, {7, 8}, {}, -300, {}, 0x01020304, {}, 3.5, Side::Sell, true, "AAPL",
+                      {{1, 2}, {3, 4}}, {"a", "bc"}, "view", raw, {9, 8, 7}};
+    const std::vector<std::byte> bytes = serialize::Serialize(order);
+
+    Order read{};
+    read.cache = 42;
+    CHECK(serialize::Deserialize(bytes, read) == bytes.size());
+    CHECK(read.id == 1 && read.price == -5 && read.inner.a == 7 && read.inner.b == 8 && read.quantity == -300);
+    CHECK(read.venue == 0x01020304 && read.cache == 42 && read.side == Side::Sell && read.live);
+    CHECK(read.symbol == "AAPL" && read.fills.size() == 2 && read.fills[1].b == 4 && read.notes[1] == "bc");
+    CHECK(read.view == "view" && read.blob.size() == 3 && read.blob[2] == std::byte{3} && read.levels[2] == 7);
+    CHECK(read.view.data() >= reinterpret_cast<const char *>(bytes.data()) &&
+          read.view.data() < reinterpret_cast<const char *>(bytes.data() + bytes.size()));
+
+    bool truncated = false;
+    try {
+        serialize::Deserialize<Order>(std::span(bytes).first(bytes.size() - 1));
+    } catch (const serialize::DecodeError &) {
+        truncated = true;
+    }
+    CHECK(truncated);
+
+    // Padding bytes never reach the wire.
+    alignas(Padded) unsigned char first[sizeof(Padded)];
+    alignas(Padded) unsigned char second[sizeof(Padded)];
+    std::memset(first, 0xaa, sizeof(first));
+    std::memset(second, 0x55, sizeof(second));
+    const Padded *a = new (first) Padded{1, 2};
+    const Padded *b = new (second) Padded{1, 2};
+    const std::vector<std::byte> encoded = serialize::Serialize(*a);
+    CHECK(encoded.size() == 9 && encoded == serialize::Serialize(*b));
+    CHECK(serialize::Deserialize<Padded>(encoded).x == 2);
+
+    const std::vector<std::byte> shifted = serialize::Serialize(Shifted{1, 'c', 'd'});
+    CHECK(shifted.size() == 6 && shifted[5] == std::byte{'d'});
+    const Shifted shifted_read = serialize::Deserialize<Shifted>(shifted);
+    CHECK(shifted_read.i == 1 && shifted_read.c == 'c' && shifted_read.d == 'd');
+    CHECK(serialize::Deserialize<Aligned>(serialize::Serialize(Aligned{'a', 5})).x == 5);
+
+    std::vector<std::byte> flag = serialize::Serialize(Flag{true, 7});
+    CHECK(flag.size() == 2 && flag[0] == std::byte{1});
+    flag[0] = std::byte{5};
+    bool rejected = false;
+    try {
+        serialize::Deserialize<Flag>(flag);
+    } catch (const serialize::DecodeError &) {
+        rejected = true;
+    }
+    CHECK(rejected);
+
+    // Varints must fit the field and be canonical.
+    const Small small = serialize::Deserialize<Small>(serialize::Serialize(Small{{}, 255, {}, -32768, {}, ~0ull}));
+    CHECK(small.u == 255 && small.s == -32768 && small.wide == ~0ull);
+    CHECK(!Rejects({0x7f, 0x00, 0x00}));
+    CHECK(Rejects({0xac, 0x02, 0x00, 0x00}));                // 300 into uint8_t
+    CHECK(Rejects({0x00, 0x80, 0x80, 0x04, 0x00}));          // 65536 into int16_t
+    CHECK(Rejects({0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02}));
+    CHECK(Rejects({0x80, 0x00, 0x00, 0x00}));                // 0 in two bytes
+}
@@ -0,0 +1,36 @@
+#include <array>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <Slice.hpp>
+#include <check.hpp>
+
+static_assert(std::is_same_v<decltype(Slice(std::declval<std::array<int, 4> &>())), Slice<int, 4, 1>>);
+static_assert(std::is_same_v<decltype(Slice(std::declval<std::vector<int> &>())), Slice<int, std::dynamic_extent, 1>>);
+static_assert(std::random_access_iterator<Slice<int>::iterator>);
+
+int main() {
+    std::vector<int> values(10);
+    std::iota(values.begin(), values.end(), 0);
+    Slice slice(values);
+
+    CHECK(slice.Size() == 10);
+    CHECK(slice[3] == 3);
+    CHECK(std::accumulate(slice.begin(), slice.end(), 0) == 45);
+
+    auto even = slice.Skip(2);
+    CHECK(even.Stride() == 2 && even[1] == 2 && even[4] == 8);
+    CHECK(slice.Skip<3>()[3] == 9);
+
+    const auto tail = slice.DropFirst(7);
+    CHECK(std::accumulate(tail.begin(), tail.end(), 0) == 7 + 8 + 9);
+
+    slice[0] = 100;
+    CHECK(values[0] == 100);
+
+    std::array<int, 4> array{1, 2, 3, 4};
+    Slice fixed(array);
+    CHECK(std::accumulate(fixed.begin(), fixed.end(), 0) == 10);
+}
@@ -0,0 +1,166 @@
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <SoAVector.hpp>
+#include <check.hpp>
+
+struct Tick {
+    long id;
+    double price;
+    Annotate<soa::Cold> _note;
+    std::string note;
+    char side;
+};
+
+// Copies throw once the budget runs out.
+struct Fragile {
+    static inline int live = 0;
+    static inline int budget = 1 << 30;
+
+    Fragile() {
+        ++live;
+    }
+
+    Fragile(const Fragile &) {
+        if (--budget < 0) {
+            throw std::runtime_error("copy failed");
+        }
+        ++live;
+    }
+
+    Fragile(Fragile &&) noexcept {
+        ++live;
+    }
+
+    Fragile &operator=(const Fragile &) = default;
+
+    ~Fragile() {
+        --live;
+    }
+};
+
+struct Row {
+    int id;
+    Fragile fragile;
+    std::string name;
+};
+
+// Moves and copies throw once the budget runs out.
+struct Sticky {
+    static inline int budget = 1 << 30;
+
+    std::string s;
+
+    Sticky() = default;
+
+    Sticky(const Sticky &other) : s(other.s) {
+        Spend();
+    }
+
+    Sticky(Sticky &&other) : s(std::move(other.s)) {
+        Spend();
+    }
+
+    static void Spend() {
+        if (--budget < 0) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+};
+
+struct Labelled {
+    std::string name;
+    Annotate<soa::Cold> _label;
+    Sticky label;
+};
+
+static_assert(std::forward_iterator<SoAVector<Tick>::iterator>);
+
+bool Aligned(const void *pointer) {
+    return reinterpret_cast<std::uintptr_t>(pointer) % 64 == 0;
+}
+
+int main() {
+    SoAVector<Tick> ticks;
+    for (int i = 0; i < 100; ++i) {
+        ticks.push_back(Tick{i, i * 1.5, {}, "note" + std::to_string(i), 'B'});
+    }
+    ticks.emplace_back(7L, 2.0, std::string(50, 'x'), 'S');
+    CHECK(ticks.size() == 101);
+
+    double sum = 0;
+    for (const double price : ticks.column<1>()) {
+        sum += price;
+    }
+    CHECK(sum == 1.5 * 4950 + 2.0);
+    CHECK(Aligned(ticks.column<0>().data()) && Aligned(ticks.column<1>().data()) &&
+          Aligned(ticks.column<2>().data()));
+
+    const Tick fifth = ticks[5];
+    CHECK(fifth.note == "note5" && fifth.id == 5);
+    ticks[3] = Tick{-1, 0, {}, "three", 'Q'};
+    CHECK(ticks[3].get<2>() == "three" && ticks[3].get<3>() == 'Q');
+
+    SoAVector<Tick> copy = ticks;
+    CHECK(copy[100].get<2>().size() == 50);
+    SoAVector<Tick> moved = std::move(copy);
+    CHECK(copy.size() == 0 && moved.size() == 101);
+    moved.pop_back();
+    int positive = 0;
+    for (auto row : std::as_const(moved)) {
+        positive += row.get<0>() >= 0;
+    }
+    CHECK(positive == 99);
+
+    {
+        SoAVector<Row> rows;
+        for (int i = 0; i < 10; ++i) {
+            rows.push_back(Row{i, {}, std::string(40, 'r')});
+        }
+        const int before = Fragile::live;
+        Fragile::budget = 5;
+        bool thrown = false;
+        try {
+            SoAVector<Row> failed(rows);
+        } catch (const std::runtime_error &) {
+            thrown = true;
+        }
+        CHECK(thrown && Fragile::live == before);
+    }
+    CHECK(Fragile::live == 0);
+
+    // At capacity, the arguments may refer to rows that growth moves.
+    SoAVector<Tick> full;
+    for (int i = 0; i < 8; ++i) {
+        full.push_back(Tick{i, 0, {}, std::string(40, static_cast<char>('a' + i)), 'B'});
+    }
+    CHECK(full.capacity() == 8);
+    full.emplace_back(full[0].get<0>(), full[1].get<1>(), full[2].get<2>(), full[3].get<3>());
+    CHECK(full.size() == 9 && full[8].get<2>() == std::string(40, 'c') && full[2].get<2>() == full[8].get<2>());
+    full.push_back(full[4]);
+    CHECK(full[9].get<2>() == std::string(40, 'e'));
+
+    // A failed growth leaves every column as it was, including the string
+    // column, whose move cannot throw.
+    SoAVector<Labelled> labelled;
+    for (int i = 0; i < 8; ++i) {
+        labelled.push_back(Labelled{std::string(40, 'n'), {}, Sticky{}});
+        labelled[i].get<1>().s = std::to_string(i);
+    }
+    Sticky::budget = 3;
+    bool thrown = false;
+    try {
+        labelled.push_back(Labelled{});
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    CHECK(thrown && labelled.size() == 8 && labelled.capacity() == 8);
+    for (int i = 0; i < 8; ++i) {
+        CHECK(labelled[i].get<0>() == std::string(40, 'n') && labelled[i].get<1>().s == std::to_string(i));
+    }
+    Sticky::budget = 1 << 30;
+    labelled.reserve(100);
+    CHECK(labelled.capacity() == 100 && labelled[7].get<1>().s == "7" && labelled[7].get<0>().size() == 40);
+}
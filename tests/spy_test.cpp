@@ -0,0 +1,96 @@
+#include <thread>
+#include <vector>
+
+#include <Spy.hpp>
+#include <check.hpp>
+
+struct Point {
+    int x = 0;
+    int y = 0;
+
+    int Sum() const {
+        return x + y;
+    }
+};
+
+static_assert(sizeof(Spy<Point, spy_mode::Disabled>) == sizeof(Point));
+static_assert(std::is_same_v<decltype(std::declval<Spy<Point, spy_mode::Disabled> &>().operator->()), Point *>);
+
+void Synchronous() {
+    std::vector<unsigned> reports;
+    Spy<Point> spy(Point{1, 2});
+    spy.setLogger([&](unsigned count) { reports.push_back(count); });
+    spy->x = 5;
+    CHECK(spy->x + spy->y + spy->Sum() == 14);
+    CHECK((reports == std::vector<unsigned>{1, 3}));
+
+    Spy<Point> copy = spy;
+    copy->y = 0;
+    CHECK(reports.size() == 3 && (*copy).y == 0 && (*spy).y == 2);
+
+    spy.setLogger();
+    spy->x = 0;
+    CHECK(reports.size() == 3);
+}
+
+void Sampled() {
+    unsigned calls = 0;
+    unsigned last = 0;
+    Spy<Point, spy_mode::Sampled<3>> spy;
+    spy.setLogger([&](unsigned count) {
+        ++calls;
+        last = count;
+    });
+    for (int i = 0; i < 9; ++i) {
+        spy->x += spy->y + 1;
+    }
+    CHECK(calls == 3 && last == 2 && (*spy).x == 9);
+}
+
+void Concurrent() {
+    constexpr int kThreads = 8;
+    constexpr int kAccesses = 20000;
+    unsigned long total = 0;
+    unsigned long calls = 0;
+    {
+        Spy<std::vector<int>, spy_mode::Concurrent<16, 256>> spy{std::vector<int>(kThreads)};
+        spy.setLogger([&](unsigned count) {
+            total += count;
+            ++calls;
+        });
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&spy, t] {
+                for (int i = 0; i < kAccesses; ++i) {
+                    ++spy->at(t);
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        CHECK(total <= kThreads * kAccesses);
+    }
+    // The destructor reports what is left below the batch size.
+    CHECK(total == kThreads * kAccesses);
+    CHECK(calls <= kThreads * (kAccesses / 256) + 1);
+
+    unsigned last = 0;
+    Spy<Point, spy_mode::Concurrent<4, 4>> batched;
+    batched.setLogger([&](unsigned count) { last = count; });
+    for (int i = 0; i < 3; ++i) {
+        batched->x += 1;
+    }
+    CHECK(last == 0);
+    batched->x += 1;
+    CHECK(last == 4);
+    batched->y = 1;
+    batched.flush();
+    CHECK(last == 1);
+}
+
+int main() {
+    Synchronous();
+    Sampled();
+    Concurrent();
+}
@@ -0,0 +1,109 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include <SpyTrace.hpp>
+#include <check.hpp>
+
+struct Counter {
+    int value = 0;
+};
+
+// Rings are over-aligned, so this is the allocation a new ring makes.
+thread_local bool fail_aligned_new = false;
+
+void *operator new(std::size_t size, std::align_val_t align) {
+    if (fail_aligned_new) {
+        throw std::bad_alloc();
+    }
+    const auto alignment = static_cast<std::size_t>(align);
+    if (void *p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+// Sanitizers supply their own nothrow variant instead of forwarding.
+void *operator new(std::size_t size, std::align_val_t align, const std::nothrow_t &) noexcept {
+    try {
+        return operator new(size, align);
+    } catch (const std::bad_alloc &) {
+        return nullptr;
+    }
+}
+
+void operator delete(void *p, std::align_val_t, const std::nothrow_t &) noexcept {
+    std::free(p);
+}
+
+int main() {
+    const char *path = "spy_trace_test.trace";
+    {
+        spy_trace::Writer writer(path);
+        Spy<Counter, spy_mode::Traced> spy;
+        // Without memory for a ring the events are dropped, and the thread
+        // gets a ring once there is memory again.
+        std::thread starved([&] {
+            fail_aligned_new = true;
+            for (int i = 0; i < 10; ++i) {
+                spy->value += 1;
+            }
+            fail_aligned_new = false;
+            for (int i = 0; i < 5; ++i) {
+                spy->value += 1;
+            }
+        });
+        starved.join();
+        // Reuses the ring released by the thread above.
+        std::thread worker([&] {
+            for (int i = 0; i < 100; ++i) {
+                spy->value += 1;
+            }
+        });
+        worker.join();
+        for (int i = 0; i < 50; ++i) {
+            spy->value = spy->value + 1;
+        }
+        CHECK((*spy).value == 165);
+
+        bool second_writer = false;
+        try {
+            spy_trace::Writer other(path);
+        } catch (const std::logic_error &) {
+            second_writer = true;
+        }
+        CHECK(second_writer);
+    }
+
+    std::FILE *file = std::fopen(path, "rb");
+    CHECK(file != nullptr);
+    char magic[8];
+    std::uint32_t header[2];
+    CHECK(std::fread(magic, sizeof(magic), 1, file) == 1 && std::fread(header, sizeof(header), 1, file) == 1);
+    CHECK(std::memcmp(magic, spy_trace::kMagic, sizeof(magic)) == 0);
+    CHECK(header[0] == spy_trace::kVersion && header[1] == sizeof(spy_trace::Event));
+
+    std::vector<spy_trace::Event> events(200);
+    events.resize(std::fread(events.data(), sizeof(spy_trace::Event), events.size(), file));
+    std::fclose(file);
+    std::remove(path);
+
+    unsigned accesses = 0;
+    std::map<std::uint32_t, int> per_thread;
+    for (const spy_trace::Event &event : events) {
+        accesses += event.accesses;
+        ++per_thread[event.thread];
+        CHECK(event.object_id == events.front().object_id);
+    }
+    CHECK(events.size() == 155 && accesses == 205);
+    CHECK((per_thread == std::map<std::uint32_t, int>{{0, 5}, {1, 100}, {2, 50}}));
+}
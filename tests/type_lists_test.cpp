@@ -0,0 +1,44 @@
+#include <type_traits>
+
+#include <type_lists.hpp>
+#include <value_types.hpp>
+#include <check.hpp>
+
+using namespace type_lists;
+using type_tuples::TTuple;
+using value_types::ValueTag;
+using value_types::VTuple;
+
+template <class T>
+using Pointer = T *;
+
+template <class T>
+struct IsIntegral {
+    static constexpr bool Value = std::is_integral_v<T>;
+};
+
+template <class L, class R>
+using Add = ValueTag<L::Value + R::Value>;
+
+using L = FromTuple<TTuple<int, double, char>>;
+
+static_assert(TypeList<L> && TypeList<Nil> && Empty<Nil> && !Empty<L>);
+static_assert(std::is_same_v<ToTuple<L>, TTuple<int, double, char>>);
+static_assert(std::is_same_v<ToTuple<Map<Pointer, L>>, TTuple<int *, double *, char *>>);
+static_assert(std::is_same_v<ToTuple<Filter<IsIntegral, L>>, TTuple<int, char>>);
+static_assert(std::is_same_v<ToTuple<Take<2, L>>, TTuple<int, double>>);
+static_assert(std::is_same_v<ToTuple<Drop<2, L>>, TTuple<char>>);
+static_assert(std::is_same_v<ToTuple<Replicate<3, int>>, TTuple<int, int, int>>);
+static_assert(std::is_same_v<ToTuple<Take<4, Cycle<FromTuple<TTuple<int, char>>>>>, TTuple<int, char, int, char>>);
+static_assert(std::is_same_v<ToTuple<Take<3, Repeat<long>>>, TTuple<long, long, long>>);
+static_assert(Foldl<Add, ValueTag<0>, FromTuple<VTuple<int, 1, 2, 3>>>::Value == 6);
+static_assert(std::is_same_v<ToTuple<Scanl<Add, ValueTag<0>, FromTuple<VTuple<int, 1, 2, 3>>>>, VTuple<int, 0, 1, 3, 6>>);
+static_assert(std::is_same_v<ToTuple<Zip2<L, FromTuple<TTuple<long, short>>>>,
+                             TTuple<TTuple<int, long>, TTuple<double, short>>>);
+static_assert(std::is_same_v<ToTuple<Inits<L>::Head>, TTuple<>>);
+static_assert(std::is_same_v<ToTuple<Inits<L>::Tail::Tail::Head>, TTuple<int, double>>);
+static_assert(std::is_same_v<ToTuple<Tails<L>::Tail::Head>, TTuple<double, char>>);
+
+int main() {
+    CHECK((std::is_same_v<ToTuple<Map<Pointer, Nil>>, TTuple<>>));
+}
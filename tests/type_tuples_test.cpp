@@ -0,0 +1,16 @@
+#include <type_traits>
+
+#include <type_tuples.hpp>
+#include <check.hpp>
+
+using namespace type_tuples;
+
+static_assert(std::is_same_v<TTuplePacker<int, TTuple<char, long>>::Type, TTuple<int, char, long>>);
+static_assert(std::is_same_v<TTuplePacker<int, TTuple<>>::Type, TTuple<int>>);
+static_assert(TypeTuple<TTuple<>>);
+static_assert(TypeTuple<TTuple<int, double>>);
+static_assert(!TypeTuple<int>);
+
+int main() {
+    CHECK((std::is_empty_v<TTuple<int, double>>));
+}
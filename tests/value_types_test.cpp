@@ -0,0 +1,14 @@
+#include <type_traits>
+
+#include <value_types.hpp>
+#include <check.hpp>
+
+using namespace value_types;
+
+static_assert(ValueTag<42>::Value == 42);
+static_assert(std::is_same_v<decltype(ValueTag<'x'>::Value), const char>);
+static_assert(std::is_same_v<VTuple<int, 1, 2>, type_tuples::TTuple<ValueTag<1>, ValueTag<2>>>);
+
+int main() {
+    CHECK(ValueTag<7u>::Value + ValueTag<-7>::Value == 0);
+}